@@ -42,20 +42,51 @@ static FlsEmu_SegmentType S12D512_EEPROM = {
     0,
 };
 
+#if XCP_DAQ_ENABLE_RESUME == XCP_ON
+#define DAQ_STORE_SEGMENT_IDX   (2)
+
+/* Holds the DAQ configuration stored by SET_REQUEST; restored by Xcp_Init(). */
+static FlsEmu_SegmentType XcpSim_DaqStore = {
+    "XCPSIM_DAQ",
+    XCP_DAQ_RESUME_IMAGE_SIZE,
+    2,
+    4,
+    XCP_DAQ_RESUME_IMAGE_SIZE,
+    1,
+    0x2000,
+    XCP_NULL,
+    0,
+};
+#endif /* XCP_DAQ_ENABLE_RESUME */
+
 static FlsEmu_SegmentType const * segments[] = {
     &S12D512_PagedFlash,
     &S12D512_EEPROM,
+#if XCP_DAQ_ENABLE_RESUME == XCP_ON
+    &XcpSim_DaqStore,
+#endif /* XCP_DAQ_ENABLE_RESUME */
 };
 
 const FlsEmu_ConfigType FlsEmu_Config = {
-    2,
+    sizeof(segments) / sizeof(segments[0]),
     (FlsEmu_SegmentType**)segments,
 };
 
+#define XCPSIM_ODT0_ENTRIES(ENTRY)      \
+    ENTRY(triangle)                     \
+    ENTRY(randomValue)
+
 const XcpDaq_ODTEntryType XcpDaq_PredefinedOdtEntries[] = {
-    XCP_DAQ_DEFINE_ODT_ENTRY(triangle),
-    XCP_DAQ_DEFINE_ODT_ENTRY(randomValue),
+    XCP_DAQ_DEFINE_ODT_ENTRIES(XCPSIM_ODT0_ENTRIES)
+};
+
+#if XCP_DAQ_ENABLE_PREDEFINED_SAMPLERS == XCP_ON
+XCP_DAQ_DEFINE_ODT_SAMPLER(XcpSim_SampleOdt0, XCPSIM_ODT0_ENTRIES)
+
+const XcpDaq_OdtSamplerType XcpDaq_PredefinedOdtSamplers[] = {
+    XCP_DAQ_ODT_SAMPLER(XcpSim_SampleOdt0, XCPSIM_ODT0_ENTRIES),
 };
+#endif /* XCP_DAQ_ENABLE_PREDEFINED_SAMPLERS */
 
 const XcpDaq_ODTType XcpDaq_PredefinedOdts[] = {
     {
@@ -152,6 +183,36 @@ Xcp_MemoryMappingResultType Xcp_HookFunction_AddressMapper(Xcp_MtaType * dst, Xc
     return FlsEmu_MemoryMapper(dst, src);
 }
 
+#if XCP_DAQ_ENABLE_RESUME == XCP_ON
+/*
+ *
+ * DAQ resume hook functions -- the DAQ configuration lives in its own flash segment.
+ *
+ */
+bool Xcp_HookFunction_StoreDaq(uint8_t const * image, uint32_t length)
+{
+    if (length > XcpSim_DaqStore.pageSize) {
+        return XCP_FALSE;
+    }
+    FlsEmu_ErasePage(DAQ_STORE_SEGMENT_IDX, 0);
+    memcpy(FlsEmu_BasePointer(DAQ_STORE_SEGMENT_IDX), image, length);
+    return XCP_TRUE;
+}
+
+bool Xcp_HookFunction_LoadDaq(uint8_t const ** image, uint32_t * length)
+{
+    *image = (uint8_t const *)FlsEmu_BasePointer(DAQ_STORE_SEGMENT_IDX);
+    *length = XcpSim_DaqStore.pageSize;
+    return XCP_TRUE;
+}
+
+bool Xcp_HookFunction_ClearDaq(void)
+{
+    FlsEmu_ErasePage(DAQ_STORE_SEGMENT_IDX, 0);
+    return XCP_TRUE;
+}
+#endif /* XCP_DAQ_ENABLE_RESUME */
+
 /*
  *
  * Example GET_ID hook function.
@@ -18,10 +18,11 @@ void XcpOnCan_Init(void);
 void * XcpHw_MainFunction(void);
 void XcpTl_MainFunction(void);
 void * TlTask(void * param);
+void * DaqTask(void * param);
 
 void * AppTask(void * param);
 
-extern pthread_t XcpHw_ThreadID[4];
+extern pthread_t XcpHw_ThreadID[5];
 
 #define XCP_THREAD  (0)
 #define UI_THREAD   (1)
@@ -124,6 +125,9 @@ int main(int argc, char **argv)
     pthread_create(&XcpHw_ThreadID[1], NULL, &AppTask, NULL);
     pthread_create(&XcpHw_ThreadID[2], NULL, &XcpTui_MainFunction, NULL);
     pthread_create(&XcpHw_ThreadID[3], NULL, &TlTask, NULL);
+#if XCP_DAQ_ENABLE_TRANSMIT_TASK == XCP_ON
+    pthread_create(&XcpHw_ThreadID[4], NULL, &DaqTask, NULL);
+#endif /* XCP_DAQ_ENABLE_TRANSMIT_TASK */
 
     pthread_join(XcpHw_ThreadID[2], NULL);
 
@@ -179,6 +183,16 @@ void * TlTask(void * param)
     return NULL;
 }
 
+#if XCP_DAQ_ENABLE_TRANSMIT_TASK == XCP_ON
+void * DaqTask(void * param)
+{
+    XCP_FOREVER {
+        XcpDaq_TransmitMainFunction();
+    }
+    return NULL;
+}
+#endif /* XCP_DAQ_ENABLE_TRANSMIT_TASK */
+
 void * AppTask(void * param)
 {
     static uint32_t currentTS = 0UL;
@@ -76,8 +76,9 @@
 **  DAQ Settings.
 */
 #define XCP_DAQ_CONFIG_TYPE                         XCP_DAQ_CONFIG_TYPE_NONE
-#define XCP_DAQ_DTO_BUFFER_SIZE                     (40)
+#define XCP_DAQ_DTO_BUFFER_SIZE                     (256)
 #define XCP_DAQ_ENABLE_PREDEFINED_LISTS             XCP_ON
+#define XCP_DAQ_ENABLE_PREDEFINED_SAMPLERS          XCP_ON      /* s. XcpSim_SampleOdt0() */
 #define XCP_DAQ_TIMESTAMP_UNIT                      (XCP_DAQ_TIMESTAMP_UNIT_10US)
 #define XCP_DAQ_TIMESTAMP_SIZE                      (XCP_DAQ_TIMESTAMP_SIZE_4)
 #define XCP_DAQ_ENABLE_PRESCALER                    XCP_OFF
@@ -90,6 +91,9 @@
 #define XCP_DAQ_MAX_DYNAMIC_ENTITIES                (100)
 #define XCP_DAQ_MAX_EVENT_CHANNEL                   (3)
 #define XCP_DAQ_ENABLE_MULTIPLE_DAQ_LISTS_PER_EVENT XCP_OFF
+#define XCP_DAQ_ENABLE_RESUME                       XCP_OFF     /* Requires dynamic DAQ lists and SET_REQUEST. */
+#define XCP_DAQ_ENABLE_TRANSMIT_TASK                XCP_ON      /* DTOs are sent by DaqTask(). */
+#define XCP_DAQ_ENABLE_LOCKED_DTO_BUFFER            XCP_ON      /* mlock() DTO buffers. */
 
 /*
 **  PGM Settings.
@@ -144,7 +148,7 @@
     #define XCP_ENABLE_ALLOC_DAQ                    XCP_ON
     #define XCP_ENABLE_ALLOC_ODT                    XCP_ON
     #define XCP_ENABLE_ALLOC_ODT_ENTRY              XCP_ON
-    #define XCP_ENABLE_WRITE_DAQ_MULTIPLE           XCP_OFF
+    #define XCP_ENABLE_WRITE_DAQ_MULTIPLE           XCP_ON
 
 #define XCP_ENABLE_PGM_COMMANDS                     XCP_ON
 
@@ -187,12 +191,16 @@
 #elif defined(ETHER)
     #define XCP_TRANSPORT_LAYER                         XCP_ON_ETHERNET
 
-    #define XCP_MAX_CTO                                 (64)    // (16)
+    #define XCP_MAX_CTO                                 (255)   /* Room for 31 WRITE_DAQ_MULTIPLE elements. */
     #define XCP_MAX_DTO                                 (64)
 
     #define XCP_TRANSPORT_LAYER_LENGTH_SIZE             (2)
     #define XCP_TRANSPORT_LAYER_COUNTER_SIZE            (2)
     #define XCP_TRANSPORT_LAYER_CHECKSUM_SIZE           (0)
+
+    #define XCP_ON_ETHERNET_ENABLE_FRAME_BATCHING       XCP_ON
+    #define XCP_ON_ETHERNET_FRAME_SIZE                  (1472)
+    #define XCP_ON_ETHERNET_FLUSH_DEADLINE              (0)     /* Send as soon as the DTO queues run empty. */
 #else
 #error NO transport-layer specified.
 #endif
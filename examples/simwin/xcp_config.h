@@ -76,7 +76,7 @@
 **  DAQ Settings.
 */
 #define XCP_DAQ_CONFIG_TYPE                         XCP_DAQ_CONFIG_TYPE_DYNAMIC
-#define XCP_DAQ_DTO_BUFFER_SIZE                     (40)
+#define XCP_DAQ_DTO_BUFFER_SIZE                     (256)
 #define XCP_DAQ_ENABLE_PREDEFINED_LISTS             XCP_OFF
 #define XCP_DAQ_TIMESTAMP_UNIT                      (XCP_DAQ_TIMESTAMP_UNIT_1US)
 #define XCP_DAQ_TIMESTAMP_SIZE                      (XCP_DAQ_TIMESTAMP_SIZE_4)
@@ -145,7 +145,7 @@
     #define XCP_ENABLE_ALLOC_DAQ                    XCP_ON
     #define XCP_ENABLE_ALLOC_ODT                    XCP_ON
     #define XCP_ENABLE_ALLOC_ODT_ENTRY              XCP_ON
-    #define XCP_ENABLE_WRITE_DAQ_MULTIPLE           XCP_OFF
+    #define XCP_ENABLE_WRITE_DAQ_MULTIPLE           XCP_ON
 
 #define XCP_ENABLE_PGM_COMMANDS                     XCP_ON
 
@@ -176,7 +176,7 @@
 #else
     #define XCP_TRANSPORT_LAYER                         XCP_ON_ETHERNET
 
-    #define XCP_MAX_CTO                                 (64)    // (16)
+    #define XCP_MAX_CTO                                 (255)   /* Room for 31 WRITE_DAQ_MULTIPLE elements. */
     #define XCP_MAX_DTO                                 (64)
 
     #define XCP_TRANSPORT_LAYER_LENGTH_SIZE             (2)
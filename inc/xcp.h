@@ -64,30 +64,22 @@ extern "C"
 */
 
 /* Check for unsupported features. */
-#if XCP_ENABLE_STIM  == XCP_ON
-    #error STIM not supported yet.
+#if (XCP_ENABLE_STIM == XCP_ON) && (XCP_ENABLE_DAQ_COMMANDS == XCP_OFF)
+    #error XCP_ENABLE_STIM requires XCP_ENABLE_DAQ_COMMANDS
 #endif /* XCP_ENABLE_STIM */
 
 #if XCP_DAQ_ENABLE_ALTERNATING == XCP_ON
     #error XCP_DAQ_ENABLE_ALTERNATING not supported yet.
 #endif /* XCP_DAQ_ENABLE_ALTERNATING */
 
-#if XCP_DAQ_ENABLE_PRIORITIZATION == XCP_ON
-    #error DAQ priorization not supported yet.
-#endif /* XCP_DAQ_ENABLE_PRIORITIZATION */
-
 #if XCP_DAQ_ENABLE_BIT_OFFSET == XCP_ON
     #error DAQ doesnt support bit-offsets yet.
 #endif /* XCP_DAQ_ENABLE_BIT_OFFSET */
 
-#if XCP_DAQ_ENABLE_ADDR_EXT == XCP_ON
-    #error DAQ doesnt support address extension.
+#if (XCP_DAQ_ENABLE_ADDR_EXT == XCP_ON) && (!defined(XCP_ENABLE_REMOTE_MEMORY) || (XCP_ENABLE_REMOTE_MEMORY == XCP_OFF))
+    #error DAQ supports address extension only to select remote memory (XCP_ENABLE_REMOTE_MEMORY).
 #endif /* XCP_DAQ_ENABLE_ADDR_EXT */
 
-#if XCP_DAQ_ENABLE_MULTIPLE_DAQ_LISTS_PER_EVENT == XCP_ON
-    #error Multiple DAQ lists per event are not supported yet.
-#endif /* XCP_DAQ_ENABLE_MULTIPLE_DAQ_LISTS_PER_EVENT */
-
 #if XCP_ENABLE_MASTER_BLOCKMODE == XCP_ON
     #if XCP_ENABLE_DOWNLOAD_NEXT == XCP_OFF
         #error Master block-mode requires optional command 'downloadNext'.
@@ -162,6 +154,21 @@ extern "C"
     #define XCP_MIN_DAQ ((XcpDaq_ListIntegerType)0)
 #endif /* XCP_DAQ_ENABLE_PREDEFINED_LISTS */
 
+#if !defined(XCP_DAQ_ENABLE_PREDEFINED_SAMPLERS)
+    #define XCP_DAQ_ENABLE_PREDEFINED_SAMPLERS  XCP_OFF
+#endif /* XCP_DAQ_ENABLE_PREDEFINED_SAMPLERS */
+
+#if XCP_DAQ_ENABLE_PREDEFINED_SAMPLERS == XCP_ON
+    #if XCP_DAQ_ENABLE_PREDEFINED_LISTS == XCP_OFF
+        #error XCP_DAQ_ENABLE_PREDEFINED_SAMPLERS requires XCP_DAQ_ENABLE_PREDEFINED_LISTS
+    #endif /* XCP_DAQ_ENABLE_PREDEFINED_LISTS */
+    #if !defined(XCP_DAQ_SAMPLER_COPY)
+        #include <string.h>
+        /* Constant sizes, so compilers emit a single load/store per measurement. */
+        #define XCP_DAQ_SAMPLER_COPY(dst, src, len)     memcpy((dst), (src), (len))
+    #endif /* XCP_DAQ_SAMPLER_COPY */
+#endif /* XCP_DAQ_ENABLE_PREDEFINED_SAMPLERS */
+
 #if (XCP_ENABLE_DAQ_COMMANDS == XCP_ON) && (XCP_DAQ_CONFIG_TYPE == XCP_DAQ_CONFIG_TYPE_NONE) && (XCP_DAQ_ENABLE_PREDEFINED_LISTS == STD_OFF)
     #error Neither predefined nor configurable lists are enabled.
 #endif
@@ -195,6 +202,16 @@ extern "C"
 #define XCP_DAQ_ODT_ENTRY_OFFSET ((1) + (1))    /* Currently fixed (only abs. ODT numbers supported). */
 #define XCP_DAQ_MAX_ODT_ENTRY_SIZE  (XCP_MAX_DTO - XCP_DAQ_ODT_ENTRY_OFFSET)    /* Max. payload. */
 
+#define XCP_WRITE_DAQ_MULTIPLE_HEADER_SIZE  (2)     /* PID, number of elements. */
+#define XCP_WRITE_DAQ_MULTIPLE_ELEMENT_SIZE (8)     /* Bit offset, size, address, extension, alignment. */
+#define XCP_WRITE_DAQ_MULTIPLE_MAX_ELEMENTS ((XCP_MAX_CTO - XCP_WRITE_DAQ_MULTIPLE_HEADER_SIZE) / XCP_WRITE_DAQ_MULTIPLE_ELEMENT_SIZE)
+
+#if (XCP_ENABLE_WRITE_DAQ_MULTIPLE == XCP_ON) && (XCP_WRITE_DAQ_MULTIPLE_MAX_ELEMENTS < 1)
+    /* Not a single element fits into a CTO (e.g. classic CAN). */
+    #undef XCP_ENABLE_WRITE_DAQ_MULTIPLE
+    #define XCP_ENABLE_WRITE_DAQ_MULTIPLE   XCP_OFF
+#endif /* XCP_ENABLE_WRITE_DAQ_MULTIPLE */
+
 #if XCP_TRANSPORT_LAYER == XCP_ON_CAN
 
 #else
@@ -213,6 +230,26 @@ extern "C"
 
 #define XCP_TRANSPORT_LAYER_BUFFER_OFFSET   (XCP_TRANSPORT_LAYER_COUNTER_SIZE + XCP_TRANSPORT_LAYER_LENGTH_SIZE)
 
+#if !defined(XCP_ON_ETHERNET_ENABLE_FRAME_BATCHING)
+    #define XCP_ON_ETHERNET_ENABLE_FRAME_BATCHING   XCP_OFF
+#endif /* XCP_ON_ETHERNET_ENABLE_FRAME_BATCHING */
+
+#if XCP_ON_ETHERNET_ENABLE_FRAME_BATCHING == XCP_ON
+    #if XCP_TRANSPORT_LAYER != XCP_ON_ETHERNET
+        #error XCP_ON_ETHERNET_ENABLE_FRAME_BATCHING only applies to XCP_ON_ETHERNET
+    #endif /* XCP_TRANSPORT_LAYER */
+    #if !defined(XCP_ON_ETHERNET_FRAME_SIZE)
+        #define XCP_ON_ETHERNET_FRAME_SIZE      (1472)  /* UDP payload of a 1500 byte IPv4 MTU. */
+    #endif /* XCP_ON_ETHERNET_FRAME_SIZE */
+    #if !defined(XCP_ON_ETHERNET_FLUSH_DEADLINE)
+        #define XCP_ON_ETHERNET_FLUSH_DEADLINE  (0)
+    #endif /* XCP_ON_ETHERNET_FLUSH_DEADLINE */
+    #if (XCP_ON_ETHERNET_FRAME_SIZE < (XCP_MAX_CTO + XCP_TRANSPORT_LAYER_BUFFER_OFFSET)) || \
+        (XCP_ON_ETHERNET_FRAME_SIZE < (XCP_MAX_DTO + XCP_TRANSPORT_LAYER_BUFFER_OFFSET)) || (XCP_ON_ETHERNET_FRAME_SIZE > 65507)
+        #error XCP_ON_ETHERNET_FRAME_SIZE must hold the largest packet and be less than 65508
+    #endif /* XCP_ON_ETHERNET_FRAME_SIZE */
+#endif /* XCP_ON_ETHERNET_ENABLE_FRAME_BATCHING */
+
 #if !defined(XCP_DAQ_ENABLE_WRITE_THROUGH)
     #define XCP_DAQ_ENABLE_WRITE_THROUGH    XCP_OFF
 #endif
@@ -221,6 +258,24 @@ extern "C"
     #define XCP_DAQ_ENABLE_RESET_DYN_DAQ_CONFIG_ON_SEQUENCE_ERROR   XCP_OFF
 #endif
 
+#if XCP_DAQ_ENABLE_DYNAMIC_LISTS == XCP_ON
+    /* Lists, ODTs, and ODT entries are carved from one arena of XCP_DAQ_DYNAMIC_MEMORY_SIZE bytes. */
+    #if !defined(XCP_DAQ_DYNAMIC_MEMORY_SIZE)
+        #if defined(XCP_DAQ_MAX_DYNAMIC_ENTITIES)
+            #define XCP_DAQ_DYNAMIC_MEMORY_SIZE (XCP_DAQ_MAX_DYNAMIC_ENTITIES * 16)
+        #else
+            #define XCP_DAQ_DYNAMIC_MEMORY_SIZE (2048)
+        #endif /* XCP_DAQ_MAX_DYNAMIC_ENTITIES */
+    #endif /* XCP_DAQ_DYNAMIC_MEMORY_SIZE */
+    #if (XCP_DAQ_DYNAMIC_MEMORY_SIZE < 16) || ((XCP_DAQ_DYNAMIC_MEMORY_SIZE / 4) > 65535)
+        #error XCP_DAQ_DYNAMIC_MEMORY_SIZE must be in range [16 .. 262140]
+    #endif /* XCP_DAQ_DYNAMIC_MEMORY_SIZE */
+    #if !defined(XCP_DAQ_MAX_DYNAMIC_ENTITIES)
+        /* ODTs are the smallest objects (4 bytes), so no count exceeds this. */
+        #define XCP_DAQ_MAX_DYNAMIC_ENTITIES    (XCP_DAQ_DYNAMIC_MEMORY_SIZE / 4)
+    #endif /* XCP_DAQ_MAX_DYNAMIC_ENTITIES */
+#endif /* XCP_DAQ_ENABLE_DYNAMIC_LISTS */
+
 #if XCP_DAQ_MAX_DYNAMIC_ENTITIES < 256
 #define XCP_DAQ_ENTITY_TYPE                         uint8_t
 #elif XCP_DAQ_MAX_DYNAMIC_ENTITIES < 65536
@@ -229,6 +284,166 @@ extern "C"
 #define XCP_DAQ_ENTITY_TYPE                         uint32_t
 #endif
 
+#if XCP_DAQ_ENABLE_MULTIPLE_DAQ_LISTS_PER_EVENT == XCP_ON
+    #if !defined(XCP_DAQ_MAX_LISTS_PER_EVENT)
+        #define XCP_DAQ_MAX_LISTS_PER_EVENT (8)
+    #endif /* XCP_DAQ_MAX_LISTS_PER_EVENT */
+    #if (XCP_DAQ_MAX_LISTS_PER_EVENT < 1) || (XCP_DAQ_MAX_LISTS_PER_EVENT > 255)
+        #error XCP_DAQ_MAX_LISTS_PER_EVENT must be in range [1 .. 255]
+    #endif /* XCP_DAQ_MAX_LISTS_PER_EVENT */
+#else
+    #if defined(XCP_DAQ_MAX_LISTS_PER_EVENT)
+        #undef XCP_DAQ_MAX_LISTS_PER_EVENT
+    #endif /* XCP_DAQ_MAX_LISTS_PER_EVENT */
+    #define XCP_DAQ_MAX_LISTS_PER_EVENT (1)
+#endif /* XCP_DAQ_ENABLE_MULTIPLE_DAQ_LISTS_PER_EVENT */
+
+#if XCP_DAQ_ENABLE_PRIORITIZATION == XCP_ON
+    #if !defined(XCP_DAQ_PRIORITY_CLASSES)
+        #define XCP_DAQ_PRIORITY_CLASSES    (4)
+    #endif /* XCP_DAQ_PRIORITY_CLASSES */
+    #if (XCP_DAQ_PRIORITY_CLASSES < 1) || (XCP_DAQ_PRIORITY_CLASSES > 256)
+        #error XCP_DAQ_PRIORITY_CLASSES must be in range [1 .. 256]
+    #endif /* XCP_DAQ_PRIORITY_CLASSES */
+#else
+    #if defined(XCP_DAQ_PRIORITY_CLASSES)
+        #undef XCP_DAQ_PRIORITY_CLASSES
+    #endif /* XCP_DAQ_PRIORITY_CLASSES */
+    #define XCP_DAQ_PRIORITY_CLASSES    (1)
+#endif /* XCP_DAQ_ENABLE_PRIORITIZATION */
+
+#define XCP_DAQ_OVERLOAD_INDICATION_NONE    (0)
+#define XCP_DAQ_OVERLOAD_INDICATION_PID     (1)
+#define XCP_DAQ_OVERLOAD_INDICATION_EVENT   (2)
+
+#if !defined(XCP_DAQ_OVERLOAD_INDICATION)
+    #define XCP_DAQ_OVERLOAD_INDICATION     XCP_DAQ_OVERLOAD_INDICATION_NONE
+#endif /* XCP_DAQ_OVERLOAD_INDICATION */
+#if (XCP_DAQ_OVERLOAD_INDICATION != XCP_DAQ_OVERLOAD_INDICATION_NONE) && \
+    (XCP_DAQ_OVERLOAD_INDICATION != XCP_DAQ_OVERLOAD_INDICATION_PID) && \
+    (XCP_DAQ_OVERLOAD_INDICATION != XCP_DAQ_OVERLOAD_INDICATION_EVENT)
+    #error XCP_DAQ_OVERLOAD_INDICATION must be XCP_DAQ_OVERLOAD_INDICATION_NONE, _PID, or _EVENT
+#endif /* XCP_DAQ_OVERLOAD_INDICATION */
+
+#if XCP_ENABLE_STIM == XCP_ON
+    #if !defined(XCP_DAQ_MAX_STIM_LISTS)
+        #define XCP_DAQ_MAX_STIM_LISTS      (4)
+    #endif /* XCP_DAQ_MAX_STIM_LISTS */
+    #if !defined(XCP_DAQ_STIM_BUFFER_SIZE)
+        #define XCP_DAQ_STIM_BUFFER_SIZE    (256)
+    #endif /* XCP_DAQ_STIM_BUFFER_SIZE */
+    #if (XCP_DAQ_MAX_STIM_LISTS < 1) || (XCP_DAQ_MAX_STIM_LISTS > 255)
+        #error XCP_DAQ_MAX_STIM_LISTS must be in range [1 .. 255]
+    #endif /* XCP_DAQ_MAX_STIM_LISTS */
+    #if (XCP_DAQ_STIM_BUFFER_SIZE < 1) || (XCP_DAQ_STIM_BUFFER_SIZE > 65535)
+        #error XCP_DAQ_STIM_BUFFER_SIZE must be in range [1 .. 65535]
+    #endif /* XCP_DAQ_STIM_BUFFER_SIZE */
+#endif /* XCP_ENABLE_STIM */
+
+#if !defined(XCP_DAQ_GATHER_PLAN_SIZE)
+    #if XCP_DAQ_ENABLE_DYNAMIC_LISTS == XCP_ON
+        /* Enough for every ODT entry the arena can hold (ODT entries take at least 8 bytes). */
+        #define XCP_DAQ_GATHER_PLAN_SIZE    (XCP_DAQ_DYNAMIC_MEMORY_SIZE / 8)
+    #else
+        #define XCP_DAQ_GATHER_PLAN_SIZE    (64)
+    #endif /* XCP_DAQ_ENABLE_DYNAMIC_LISTS */
+#endif /* XCP_DAQ_GATHER_PLAN_SIZE */
+
+#if !defined(XCP_DAQ_PLAN_ACQUIRE_RETRIES)
+    #define XCP_DAQ_PLAN_ACQUIRE_RETRIES    (1000)
+#endif /* XCP_DAQ_PLAN_ACQUIRE_RETRIES */
+#if XCP_DAQ_PLAN_ACQUIRE_RETRIES < 1
+    #error XCP_DAQ_PLAN_ACQUIRE_RETRIES must be at least 1
+#endif /* XCP_DAQ_PLAN_ACQUIRE_RETRIES */
+
+#if !defined(XCP_DAQ_ENABLE_LOCK_FREE_DTO_QUEUE)
+    #if defined(C11_COMPILER) && !defined(__STDC_NO_ATOMICS__)
+        #define XCP_DAQ_ENABLE_LOCK_FREE_DTO_QUEUE  XCP_ON
+    #else
+        #define XCP_DAQ_ENABLE_LOCK_FREE_DTO_QUEUE  XCP_OFF
+    #endif /* C11_COMPILER */
+#endif /* XCP_DAQ_ENABLE_LOCK_FREE_DTO_QUEUE */
+
+#if XCP_DAQ_ENABLE_LOCK_FREE_DTO_QUEUE == XCP_ON
+    #if !defined(C11_COMPILER) || defined(__STDC_NO_ATOMICS__)
+        #error XCP_DAQ_ENABLE_LOCK_FREE_DTO_QUEUE requires C11 atomics
+    #endif /* C11_COMPILER */
+    #include <stdatomic.h>
+#endif /* XCP_DAQ_ENABLE_LOCK_FREE_DTO_QUEUE */
+
+#if !defined(XCP_DAQ_ENABLE_TRANSMIT_TASK)
+    #define XCP_DAQ_ENABLE_TRANSMIT_TASK    XCP_OFF
+#endif /* XCP_DAQ_ENABLE_TRANSMIT_TASK */
+
+#if !defined(XCP_DAQ_ENABLE_SEQLOCK)
+    #define XCP_DAQ_ENABLE_SEQLOCK      XCP_OFF
+#endif /* XCP_DAQ_ENABLE_SEQLOCK */
+
+#if XCP_DAQ_ENABLE_SEQLOCK == XCP_ON
+    #if !defined(C11_COMPILER) || defined(__STDC_NO_ATOMICS__)
+        #error XCP_DAQ_ENABLE_SEQLOCK requires C11 atomics
+    #endif /* C11_COMPILER */
+    #include <stdatomic.h>
+    #if !defined(XCP_DAQ_SNAPSHOT_BUFFER_SIZE)
+        #define XCP_DAQ_SNAPSHOT_BUFFER_SIZE    (256)
+    #endif /* XCP_DAQ_SNAPSHOT_BUFFER_SIZE */
+    #if (XCP_DAQ_SNAPSHOT_BUFFER_SIZE < 1) || (XCP_DAQ_SNAPSHOT_BUFFER_SIZE > 65535)
+        #error XCP_DAQ_SNAPSHOT_BUFFER_SIZE must be in range [1 .. 65535]
+    #endif /* XCP_DAQ_SNAPSHOT_BUFFER_SIZE */
+    #if !defined(XCP_DAQ_SEQLOCK_MAX_RETRIES)
+        #define XCP_DAQ_SEQLOCK_MAX_RETRIES     (16)
+    #endif /* XCP_DAQ_SEQLOCK_MAX_RETRIES */
+#endif /* XCP_DAQ_ENABLE_SEQLOCK */
+
+#if !defined(XCP_DAQ_ENABLE_RESUME)
+    #define XCP_DAQ_ENABLE_RESUME       XCP_OFF
+#endif /* XCP_DAQ_ENABLE_RESUME */
+
+#if XCP_DAQ_ENABLE_RESUME == XCP_ON
+    #if XCP_DAQ_ENABLE_DYNAMIC_LISTS == XCP_OFF
+        #error XCP_DAQ_ENABLE_RESUME requires dynamic DAQ lists
+    #endif /* XCP_DAQ_ENABLE_DYNAMIC_LISTS */
+    #if XCP_ENABLE_SET_REQUEST == XCP_OFF
+        #error XCP_DAQ_ENABLE_RESUME requires XCP_ENABLE_SET_REQUEST
+    #endif /* XCP_ENABLE_SET_REQUEST */
+    #if !defined(XCP_DAQ_RESUME_IMAGE_SIZE)
+        #define XCP_DAQ_RESUME_IMAGE_SIZE   (4096)
+    #endif /* XCP_DAQ_RESUME_IMAGE_SIZE */
+#endif /* XCP_DAQ_ENABLE_RESUME */
+
+#if !defined(XCP_CACHE_LINE_SIZE)
+    #define XCP_CACHE_LINE_SIZE     (64)
+#endif /* XCP_CACHE_LINE_SIZE */
+
+#if (XCP_ENABLE_DAQ_COMMANDS == XCP_ON) && \
+    ((XCP_DAQ_DTO_BUFFER_SIZE < 2) || (XCP_DAQ_DTO_BUFFER_SIZE > 0x40000000) || ((XCP_DAQ_DTO_BUFFER_SIZE & (XCP_DAQ_DTO_BUFFER_SIZE - 1)) != 0))
+    #error XCP_DAQ_DTO_BUFFER_SIZE must be a power of two in range [2 .. 0x40000000]
+#endif /* XCP_DAQ_DTO_BUFFER_SIZE */
+
+/* Free-running DTO queue indices must hold at least twice the buffer size. */
+#if XCP_DAQ_DTO_BUFFER_SIZE <= 32768
+#define XCP_DAQ_DTO_INDEX_TYPE                      uint16_t
+#else
+#define XCP_DAQ_DTO_INDEX_TYPE                      uint32_t
+#endif /* XCP_DAQ_DTO_BUFFER_SIZE */
+
+#if !defined(XCP_DAQ_ENABLE_LOCKED_DTO_BUFFER)
+    #define XCP_DAQ_ENABLE_LOCKED_DTO_BUFFER    XCP_OFF
+#endif /* XCP_DAQ_ENABLE_LOCKED_DTO_BUFFER */
+
+#if !defined(XCP_ENABLE_REMOTE_MEMORY)
+    #define XCP_ENABLE_REMOTE_MEMORY    XCP_OFF
+#endif /* XCP_ENABLE_REMOTE_MEMORY */
+
+#if XCP_ENABLE_REMOTE_MEMORY == XCP_ON
+    #if !defined(XCP_REMOTE_MEMORY_ADDRESS_EXTENSION)
+        #define XCP_REMOTE_MEMORY_ADDRESS_EXTENSION     (0x01)
+    #endif /* XCP_REMOTE_MEMORY_ADDRESS_EXTENSION */
+    #if (XCP_REMOTE_MEMORY_ADDRESS_EXTENSION < 1) || (XCP_REMOTE_MEMORY_ADDRESS_EXTENSION > 255)
+        #error XCP_REMOTE_MEMORY_ADDRESS_EXTENSION must be in range [1 .. 255], extension 0 is local memory
+    #endif /* XCP_REMOTE_MEMORY_ADDRESS_EXTENSION */
+#endif /* XCP_ENABLE_REMOTE_MEMORY */
+
 #define XCP_SET_ID(name) { UINT16(sizeof((name)) - UINT16(1)), (uint8_t const *)(name) }
 
 #if !defined(XCP_MAX_BS)
@@ -328,6 +543,16 @@ extern "C"
 #define XCP_DAQ_PROP_PRESCALER_SUPPORTED    ((uint8_t)0x02)
 #define XCP_DAQ_PROP_DAQ_CONFIG_TYPE        ((uint8_t)0x01)
 
+/* Event Packets */
+#define XCP_PID_EV                          ((uint8_t)0xFD)
+#define XCP_EV_CLEAR_DAQ                    ((uint8_t)0x01)
+#define XCP_EV_STORE_DAQ                    ((uint8_t)0x02)
+#define XCP_EV_DAQ_OVERLOAD                 ((uint8_t)0x06)
+#define XCP_DAQ_OVERLOAD_PID_MSB            ((uint8_t)0x80)
+
+/* Packets with a PID up to this value are STIM DTOs. */
+#define XCP_PID_STIM_MAX                    ((uint8_t)0xBF)
+
 /* DAQ Key Byte */
 #define XCP_DAQ_KEY_IDENTIFICATION_FIELD_TYPE_1 ((uint8_t)0x80)
 #define XCP_DAQ_KEY_IDENTIFICATION_FIELD_TYPE_0 ((uint8_t)0x40)
@@ -380,21 +605,67 @@ extern "C"
 #define XCP_DAQ_PREDEFINDED_LIST_COUNT      (sizeof(XcpDaq_PredefinedLists) / sizeof(XcpDaq_PredefinedLists[0]))
 
 /* DAQ Implementation Macros */
+/* Predefined measurements are local memory; without bit offset, i.e. 0xff. */
+#if XCP_DAQ_ENABLE_ADDR_EXT == XCP_ON
+#define XCP_DAQ_ODT_ENTRY_MTA(meas)                         {UINT8(0), (const uint32_t)&(meas)}
+#else
+#define XCP_DAQ_ODT_ENTRY_MTA(meas)                         {(const uint32_t)&(meas)}
+#endif /* XCP_DAQ_ENABLE_ADDR_EXT */
+
+#if XCP_DAQ_ENABLE_BIT_OFFSET == XCP_ON
 #define XCP_DAQ_DEFINE_ODT_ENTRY(meas)                      \
     {                                                       \
-        {(const uint32_t)&(meas)},      sizeof((meas))      \
+        XCP_DAQ_ODT_ENTRY_MTA(meas), UINT8(0xff), sizeof((meas)) \
     }
+#else
+#define XCP_DAQ_DEFINE_ODT_ENTRY(meas)                      \
+    {                                                       \
+        XCP_DAQ_ODT_ENTRY_MTA(meas),    sizeof((meas))      \
+    }
+#endif /* XCP_DAQ_ENABLE_BIT_OFFSET */
+
+/*
+**  The measurements of a predefined ODT may be listed once as an X-macro, `entries(ENTRY)`
+**  expanding to `ENTRY(meas)` for each of them; the same list then yields the ODT entries
+**  and a straight-line sampler with constant addresses and sizes:
+**
+**      #define ODT0_ENTRIES(ENTRY)     ENTRY(triangle) ENTRY(randomValue)
+**
+**      const XcpDaq_ODTEntryType XcpDaq_PredefinedOdtEntries[] = { XCP_DAQ_DEFINE_ODT_ENTRIES(ODT0_ENTRIES) };
+**      XCP_DAQ_DEFINE_ODT_SAMPLER(SampleOdt0, ODT0_ENTRIES)
+**      const XcpDaq_OdtSamplerType XcpDaq_PredefinedOdtSamplers[] = { XCP_DAQ_ODT_SAMPLER(SampleOdt0, ODT0_ENTRIES) };
+*/
+#define XCP_DAQ_ODT_ENTRY_ITEM(meas)                        XCP_DAQ_DEFINE_ODT_ENTRY(meas),
+#define XCP_DAQ_DEFINE_ODT_ENTRIES(entries)                 entries(XCP_DAQ_ODT_ENTRY_ITEM)
+
+#define XCP_DAQ_ODT_ENTRY_SIZE(meas)                        + sizeof((meas))
+#define XCP_DAQ_ODT_SAMPLE_ENTRY(meas)                      \
+    XCP_DAQ_SAMPLER_COPY(dst, &(meas), sizeof((meas)));     \
+    dst += sizeof((meas));
+
+#define XCP_DAQ_DEFINE_ODT_SAMPLER(name, entries)           \
+    static void name(uint8_t * dst)                         \
+    {                                                       \
+        entries(XCP_DAQ_ODT_SAMPLE_ENTRY)                   \
+    }
+
+/* One per predefined ODT, in the order of XcpDaq_PredefinedOdts. */
+#define XCP_DAQ_ODT_SAMPLER(name, entries)                  { (name), (uint16_t)(0 entries(XCP_DAQ_ODT_ENTRY_SIZE)) }
+#define XCP_DAQ_NO_ODT_SAMPLER                              { XCP_NULL, 0 }
 
 /* DAQ Event Implementation Macros */
 #define XCP_DAQ_BEGIN_EVENTS    const XcpDaq_EventType XcpDaq_Events[XCP_DAQ_MAX_EVENT_CHANNEL] = {
 #define XCP_DAQ_END_EVENTS      };
 #define XCP_DAQ_DEFINE_EVENT(name, props, timebase, cycle)  \
+    XCP_DAQ_DEFINE_EVENT_PRIO(name, props, timebase, cycle, 0)
+#define XCP_DAQ_DEFINE_EVENT_PRIO(name, props, timebase, cycle, priority)  \
     {                                                       \
         (uint8_t const * const)(name),                      \
         sizeof((name)) - 1,                                 \
         (props),                                            \
         (timebase),                                         \
         (cycle),                                            \
+        (priority),                                         \
     }
 
 
@@ -675,6 +946,10 @@ typedef struct tagXcp_StateType {
     uint8_t seedRequested;
 #endif /* XCP_ENABLE_RESOURCE_PROTECTION */
     Xcp_MtaType mta;
+#if XCP_DAQ_ENABLE_RESUME == XCP_ON
+    uint8_t sessionStatus;
+    uint16_t sessionConfigurationId;
+#endif /* XCP_DAQ_ENABLE_RESUME */
 #if XCP_ENABLE_SLAVE_BLOCKMODE == XCP_ON
     Xcp_BlockModeStateType slaveBlockModeState;
 #endif  /* XCP_ENABLE_SLAVE_BLOCKMODE */
@@ -738,14 +1013,34 @@ typedef enum tagXcpDaq_DirectionType {
 } XcpDaq_DirectionType;
 
 
-typedef struct tagXcpDaq_XcpDaq_DynamicListType {
-    XcpDaq_ODTIntegerType numOdts;
-    uint16_t firstOdt;
+/* Overrun bookkeeping of a DAQ list, written by the producer of its event channel. */
+#if XCP_DAQ_ENABLE_LOCK_FREE_DTO_QUEUE == XCP_ON
+typedef _Atomic uint8_t XcpDaq_OverloadFlagType;
+typedef _Atomic uint32_t XcpDaq_OverrunCountType;
+#else
+typedef uint8_t XcpDaq_OverloadFlagType;
+typedef uint32_t XcpDaq_OverrunCountType;
+#endif /* XCP_DAQ_ENABLE_LOCK_FREE_DTO_QUEUE */
+
+typedef struct tagXcpDaq_ListStateType {
     uint8_t mode;
 #if XCP_DAQ_ENABLE_PRESCALER == XCP_ON
     uint8_t prescaler;
     uint8_t  counter;
 #endif /* XCP_DAQ_ENABLE_PRESCALER */
+#if XCP_DAQ_ENABLE_PRIORITIZATION == XCP_ON
+    uint8_t priority;
+#endif /* XCP_DAQ_ENABLE_PRIORITIZATION */
+    XcpDaq_OverloadFlagType overload;   /* Overrun not yet indicated to the master. */
+    XcpDaq_ODTIntegerType firstPid;     /* Number of ODTs of all preceding lists, s. XcpDaq_GetFirstPid(). */
+    XcpDaq_OverrunCountType overruns;   /* DTOs lost since the list was started. */
+} XcpDaq_ListStateType;
+
+
+typedef struct tagXcpDaq_XcpDaq_DynamicListType {
+    XcpDaq_ODTIntegerType numOdts;
+    uint16_t firstOdt;
+    XcpDaq_ListStateType state;
 } XcpDaq_DynamicListType;
 
 
@@ -754,32 +1049,15 @@ typedef struct tagXcpDaq_ListConfigurationType {
     uint16_t firstOdt;
 } XcpDaq_ListConfigurationType;
 
+#if XCP_DAQ_ENABLE_PREDEFINED_SAMPLERS == XCP_ON
+/* Copies the measurements of an ODT back to back, s. XCP_DAQ_DEFINE_ODT_SAMPLER. */
+typedef void (*XcpDaq_SampleFunctionType)(uint8_t * dst);
 
-typedef struct tagXcpDaq_ListStateType {
-    uint8_t mode;
-#if XCP_DAQ_ENABLE_PRESCALER == XCP_ON
-    uint8_t prescaler;
-    uint8_t  counter;
-#endif /* XCP_DAQ_ENABLE_PRESCALER */
-} XcpDaq_ListStateType;
-
-
-typedef enum tagXcpDaq_EntityKindType {
-    XCP_ENTITY_UNUSED,
-    XCP_ENTITY_DAQ_LIST,
-    XCP_ENTITY_ODT,
-    XCP_ENTITY_ODT_ENTRY
-} XcpDaq_EntityKindType;
-
-
-typedef struct tagXcpDaq_EntityType {
-    /*Xcp_DaqEntityKindType*/uint8_t kind;
-    union {
-        XcpDaq_ODTEntryType odtEntry;
-        XcpDaq_ODTType odt;
-        XcpDaq_DynamicListType daqList;
-    } entity;
-} XcpDaq_EntityType;
+typedef struct tagXcpDaq_OdtSamplerType {
+    XcpDaq_SampleFunctionType sample;   /* NULL: sample through the ODT entries. */
+    uint16_t length;                    /* Bytes written by `sample`. */
+} XcpDaq_OdtSamplerType;
+#endif /* XCP_DAQ_ENABLE_PREDEFINED_SAMPLERS */
 
 
 typedef struct tagXcpDaq_EventType {
@@ -788,25 +1066,83 @@ typedef struct tagXcpDaq_EventType {
     uint8_t properties;
     uint8_t timeunit;
     uint8_t cycle;
-    /* unit8_t priority; */
+    uint8_t priority;   /* 0xff highest, 0x00 lowest. */
 } XcpDaq_EventType;
 
 
+#if XCP_DAQ_ENABLE_LOCK_FREE_DTO_QUEUE == XCP_ON
+typedef _Atomic XCP_DAQ_DTO_INDEX_TYPE XcpDaq_DtoIndexType;
+#else
+typedef XCP_DAQ_DTO_INDEX_TYPE XcpDaq_DtoIndexType;
+#endif /* XCP_DAQ_ENABLE_LOCK_FREE_DTO_QUEUE */
+
+/*
+**  Single-producer/single-consumer state of an event channel's DTO queue; both indices
+**  are free-running and masked with (XCP_DAQ_DTO_BUFFER_SIZE - 1) on access.
+*/
 typedef struct tagXcpDaq_DtoBufferStateType {
-    uint16_t numEntries;
-    uint16_t front;
-    uint16_t back;
-    uint16_t allocated;
+    XcpDaq_DtoIndexType back;   /* Written by producer (XcpDaq_TriggerEvent) only. */
+#if XCP_DAQ_ENABLE_LOCK_FREE_DTO_QUEUE == XCP_ON
+    uint8_t pad0[XCP_CACHE_LINE_SIZE - sizeof(XcpDaq_DtoIndexType)];
+#endif /* XCP_DAQ_ENABLE_LOCK_FREE_DTO_QUEUE */
+    XcpDaq_DtoIndexType front;  /* Written by consumer (transport layer) only. */
+#if XCP_DAQ_ENABLE_LOCK_FREE_DTO_QUEUE == XCP_ON
+    uint8_t pad1[XCP_CACHE_LINE_SIZE - sizeof(XcpDaq_DtoIndexType)];
+#endif /* XCP_DAQ_ENABLE_LOCK_FREE_DTO_QUEUE */
 } XcpDaq_DtoBufferStateType;
 
 
+typedef struct tagXcpDaq_QueueStatisticsType {
+    uint32_t depth;     /* Bytes currently queued. */
+    uint32_t dropped;   /* DTOs lost due to overflow. */
+} XcpDaq_QueueStatisticsType;
+
+
+#if XCP_DAQ_ENABLE_SEQLOCK == XCP_ON
+/*
+**  Sequence lock guarding the measurement variables of an event channel: the (single) writer
+**  makes the sequence odd while updating, DAQ sampling retries until it sees the same even sequence
+**  before and after copying.
+*/
+typedef struct tagXcpDaq_SeqLockType {
+    _Atomic uint32_t sequence;
+} XcpDaq_SeqLockType;
+
+#define XCP_DAQ_SEQLOCK_INITIALIZER     { 0 }
+#endif /* XCP_DAQ_ENABLE_SEQLOCK */
+
+
+#if XCP_ENABLE_STIM == XCP_ON
+typedef struct tagXcpDaq_StimLatencyType {
+    uint32_t last;      /* Ticks of XcpHw_GetTimerCounter() from reception of a complete STIM list to its application. */
+    uint32_t max;
+    uint32_t applied;   /* Number of data sets applied since the list was started. */
+} XcpDaq_StimLatencyType;
+#endif /* XCP_ENABLE_STIM */
+
+
 typedef struct tagXcpDaq_MessageType {
     uint8_t dlc;
     uint8_t const * data;
 } XcpDaq_MessageType;
 
+/* Caller-supplied event timestamps (XcpDaq_TriggerEventAt()), in units of XCP_DAQ_TIMESTAMP_UNIT. */
+#if defined(C11_COMPILER)
+typedef uint64_t XcpDaq_TimestampType;
+#else
+typedef uint32_t XcpDaq_TimestampType;
+#endif /* C11_COMPILER */
+
 #endif /* XCP_ENABLE_DAQ_COMMANDS */
 
+#if XCP_ENABLE_REMOTE_MEMORY == XCP_ON
+/* A range of target process memory, `address` is relative to the base set by the platform. */
+typedef struct tagXcpHw_RemoteSegmentType {
+    uint32_t address;
+    uint32_t length;
+} XcpHw_RemoteSegmentType;
+#endif /* XCP_ENABLE_REMOTE_MEMORY */
+
 
 typedef enum tagXcp_MemoryAccessType {
     XCP_MEM_ACCESS_READ,
@@ -883,18 +1219,52 @@ bool XcpDaq_ValidateConfiguration(void);
 bool XcpDaq_ValidateList(XcpDaq_ListIntegerType daqListNumber);
 bool XcpDaq_ValidateOdtEntry(XcpDaq_ListIntegerType daqListNumber, XcpDaq_ODTIntegerType odtNumber, XcpDaq_ODTEntryIntegerType odtEntry);
 void XcpDaq_MainFunction(void);
-void XcpDaq_AddEventChannel(XcpDaq_ListIntegerType daqListNumber, uint16_t eventChannelNumber);
+bool XcpDaq_AddEventChannel(XcpDaq_ListIntegerType daqListNumber, uint16_t eventChannelNumber);
 void XcpDaq_CopyMemory(void * dst, void * src, uint32_t len);
 XcpDaq_EventType const * XcpDaq_GetEventConfiguration(uint16_t eventChannelNumber);
-void XcpDaq_TriggerEvent(uint8_t eventChannelNumber);
+void XcpDaq_TriggerEvent(uint16_t eventChannelNumber);
+void XcpDaq_TriggerEventAt(uint16_t eventChannelNumber, XcpDaq_TimestampType timestamp);
+void XcpDaq_TriggerEventsAt(uint16_t const * eventChannelNumbers, uint16_t count, XcpDaq_TimestampType timestamp);
 void XcpDaq_GetProperties(uint8_t * properties);
 XcpDaq_ListIntegerType XcpDaq_GetListCount(void);
 void XcpDaq_SetProcessorState(XcpDaq_ProcessorStateType state);
-void XcpDaq_StartSelectedLists(void);
-void XcpDaq_StopSelectedLists(void);
-void XcpDaq_StopAllLists(void);
+Xcp_ReturnType XcpDaq_StartSelectedLists(void);
+Xcp_ReturnType XcpDaq_StopSelectedLists(void);
+Xcp_ReturnType XcpDaq_StopAllLists(void);
+#if XCP_ENABLE_ADDRESS_MAPPER == XCP_ON
+bool XcpDaq_RemapAddressRange(uint32_t address, uint32_t length);
+#endif /* XCP_ENABLE_ADDRESS_MAPPER */
 bool XcpDaq_GetFirstPid(XcpDaq_ListIntegerType daqListNumber, XcpDaq_ODTIntegerType * firstPID);
+bool XcpDaq_EnqueueMessage(uint16_t eventChannelNumber, uint8_t priority, XcpDaq_MessageType const * msg);
 bool XcpDaq_DequeueMessage(XcpDaq_MessageType * msg);
+uint8_t * XcpDaq_ReserveMessage(uint16_t eventChannelNumber, uint8_t priority, uint8_t dlc);
+void XcpDaq_CommitMessage(uint16_t eventChannelNumber, uint8_t priority, uint8_t dlc);
+void XcpDaq_GetQueueStatistics(uint8_t priorityClass, XcpDaq_QueueStatisticsType * stats);
+uint32_t XcpDaq_GetListOverruns(XcpDaq_ListIntegerType daqListNumber);
+uint32_t XcpDaq_GetEventOverruns(uint16_t eventChannelNumber);
+#if (XCP_ENABLE_REMOTE_MEMORY == XCP_ON) && (XCP_DAQ_ENABLE_ADDR_EXT == XCP_ON)
+uint32_t XcpDaq_GetRemoteReadErrors(uint16_t eventChannelNumber);
+#endif /* XCP_ENABLE_REMOTE_MEMORY */
+#if XCP_DAQ_ENABLE_TRANSMIT_TASK == XCP_ON
+void XcpDaq_WaitForMessages(void);
+void XcpDaq_TransmitMainFunction(void);
+#endif /* XCP_DAQ_ENABLE_TRANSMIT_TASK */
+#if XCP_DAQ_ENABLE_SEQLOCK == XCP_ON
+void XcpDaq_SetEventSeqLock(uint16_t eventChannelNumber, XcpDaq_SeqLockType * lock);
+void XcpDaq_SeqLockWriteBegin(XcpDaq_SeqLockType * lock);
+void XcpDaq_SeqLockWriteEnd(XcpDaq_SeqLockType * lock);
+uint32_t XcpDaq_GetSeqLockSkips(uint16_t eventChannelNumber);
+#endif /* XCP_DAQ_ENABLE_SEQLOCK */
+#if XCP_ENABLE_STIM == XCP_ON
+void XcpDaq_ReceiveStim(uint8_t const * data, uint16_t len);
+bool XcpDaq_GetStimLatency(XcpDaq_ListIntegerType daqListNumber, XcpDaq_StimLatencyType * latency);
+#endif /* XCP_ENABLE_STIM */
+#if XCP_DAQ_ENABLE_RESUME == XCP_ON
+uint32_t XcpDaq_StoreConfiguration(uint8_t * image, uint32_t size, bool resume, uint16_t sessionConfigurationId);
+bool XcpDaq_RestoreConfiguration(uint8_t const * image, uint32_t size, uint16_t * sessionConfigurationId);
+#endif /* XCP_DAQ_ENABLE_RESUME */
+bool XcpDaq_PeekMessage(XcpDaq_MessageType * msg);
+void XcpDaq_ReleaseMessage(void);
 void XcpDaq_SetPointer(XcpDaq_ListIntegerType daqListNumber, XcpDaq_ODTIntegerType odtNumber, XcpDaq_ODTEntryIntegerType odtEntryNumber);
 /*
 **  Predefined DAQ constants.
@@ -906,6 +1276,9 @@ extern const XcpDaq_ListConfigurationType XcpDaq_PredefinedLists[];
 extern const XcpDaq_ListIntegerType XcpDaq_PredefinedListCount;
 extern XcpDaq_ListStateType XcpDaq_PredefinedListsState[];
 #endif /* XCP_DAQ_ENABLE_PREDEFINED_LISTS */
+#if XCP_DAQ_ENABLE_PREDEFINED_SAMPLERS == XCP_ON
+extern const XcpDaq_OdtSamplerType XcpDaq_PredefinedOdtSamplers[];
+#endif /* XCP_DAQ_ENABLE_PREDEFINED_SAMPLERS */
 
 extern const XcpDaq_EventType XcpDaq_Events[];
 
@@ -913,12 +1286,13 @@ extern const XcpDaq_EventType XcpDaq_Events[];
 ** Debugging / Testing interface.
 */
 #if XCP_BUILD_TYPE == XCP_DEBUG_BUILD
-void XcpDaq_GetCounts(XCP_DAQ_ENTITY_TYPE * entityCount, XCP_DAQ_ENTITY_TYPE * listCount, XCP_DAQ_ENTITY_TYPE * odtCount);
-uint16_t XcpDaq_TotalDynamicEntityCount(void);
-XcpDaq_EntityType *  XcpDaq_GetDynamicEntities(void);
-XcpDaq_EntityType * XcpDaq_GetDynamicEntity(uint16_t num);
+void XcpDaq_GetCounts(uint16_t * entityCount, uint16_t * listCount, uint16_t * odtCount);
+#if XCP_DAQ_ENABLE_DYNAMIC_LISTS == XCP_ON
+void XcpDaq_GetDynamicMemory(uint32_t * used, uint32_t * size);
+#endif /* XCP_DAQ_ENABLE_DYNAMIC_LISTS */
 
-uint8_t * XcpDaq_GetDtoBuffer(void);
+uint8_t * XcpDaq_GetDtoBuffer(uint16_t eventChannelNumber, uint8_t priority);
+uint16_t XcpDaq_GetGatherEntryCount(void);
 #endif // XCP_BUILD_TYPE
 
 #endif /* XCP_ENABLE_DAQ_COMMANDS */
@@ -967,6 +1341,12 @@ void XcpPgm_SetProcessorState(XcpPgm_ProcessorStateType state);
 **
 */
 void Xcp_SendPdu(void);
+#if XCP_ENABLE_DAQ_COMMANDS == XCP_ON
+void Xcp_SendDto(XcpDaq_MessageType const * msg);
+#endif /* XCP_ENABLE_DAQ_COMMANDS */
+#if XCP_ON_ETHERNET_ENABLE_FRAME_BATCHING == XCP_ON
+void Xcp_FlushFrame(void);
+#endif /* XCP_ON_ETHERNET_ENABLE_FRAME_BATCHING */
 uint8_t * Xcp_GetOutPduPtr(void);
 void Xcp_SetPduOutLen(uint16_t len);
 void Xcp_Send8(uint8_t len, uint8_t b0, uint8_t b1, uint8_t b2, uint8_t b3, uint8_t b4, uint8_t b5, uint8_t b6, uint8_t b7);
@@ -1014,6 +1394,12 @@ bool Xcp_HookFunction_Unlock(uint8_t resource, Xcp_1DArrayType const * key);
 bool Xcp_HookFunction_CheckMemoryAccess(Xcp_MtaType mta, uint32_t length, Xcp_MemoryAccessType access, bool programming);
 Xcp_MemoryMappingResultType Xcp_HookFunction_AddressMapper(Xcp_MtaType * dst, Xcp_MtaType const * src);
 
+#if XCP_DAQ_ENABLE_RESUME == XCP_ON
+bool Xcp_HookFunction_StoreDaq(uint8_t const * image, uint32_t length);
+bool Xcp_HookFunction_LoadDaq(uint8_t const ** image, uint32_t * length);
+bool Xcp_HookFunction_ClearDaq(void);
+#endif /* XCP_DAQ_ENABLE_RESUME */
+
 /*
 **  Hardware dependent stuff.
 */
@@ -1022,6 +1408,17 @@ void XcpHw_Deinit(void);
 uint32_t XcpHw_GetTimerCounter(void);
 void XcpHw_AcquireLock(uint8_t lockIdx);
 void XcpHw_ReleaseLock(uint8_t lockIdx);
+#if XCP_DAQ_ENABLE_TRANSMIT_TASK == XCP_ON
+void XcpHw_WaitTransmitRequest(void);
+void XcpHw_SignalTransmitRequest(void);
+#endif /* XCP_DAQ_ENABLE_TRANSMIT_TASK */
+#if XCP_DAQ_ENABLE_LOCKED_DTO_BUFFER == XCP_ON
+bool XcpHw_LockMemory(void * address, uint32_t size);
+#endif /* XCP_DAQ_ENABLE_LOCKED_DTO_BUFFER */
+#if XCP_ENABLE_REMOTE_MEMORY == XCP_ON
+bool XcpHw_ReadRemoteMemory(uint8_t * dst, XcpHw_RemoteSegmentType const * segments, uint16_t numSegments);
+bool XcpHw_WriteRemoteMemory(uint32_t address, uint8_t const * src, uint32_t length);
+#endif /* XCP_ENABLE_REMOTE_MEMORY */
 
 extern Xcp_PDUType Xcp_PduIn;
 extern Xcp_PDUType Xcp_PduOut;
@@ -44,6 +44,10 @@ void XcpHw_SignalApplicationState(uint32_t state, uint8_t signal_all);
 uint32_t XcpHw_WaitApplicationState(uint32_t mask);
 void XcpHw_ResetApplicationState(uint32_t mask);
 
+#if XCP_ENABLE_REMOTE_MEMORY == XCP_ON
+void XcpHw_SetRemoteProcess(int32_t pid, uintptr_t base);
+#endif /* XCP_ENABLE_REMOTE_MEMORY */
+
 #if XCP_ENABLE_EXTERN_C_GUARDS == XCP_ON
 #if defined(__cplusplus)
 }
@@ -60,6 +60,10 @@ typedef unsigned short      uint16_t;
 typedef signed long         int32_t;
 typedef unsigned long       uint32_t;
 
+#if !defined(_UINTPTR_T_DEFINED) && !defined(__uintptr_t_defined)
+typedef unsigned long       uintptr_t;  /* Holds a pointer on ILP32 and LP64 targets. */
+#endif
+
 #if 0
 typedef signed long long    int64_t;
 typedef unsigned long long  uint64_t;
@@ -37,7 +37,22 @@ extern "C"
 
 #include "xcp_types.h"
 
+/*
+**  Widest naturally aligned member XcpUtl_SampleCopy() reads with a single load (C11 compilers);
+**  8-byte loads only where they are native, i.e. on 64-bit targets.
+*/
+#if defined(C11_COMPILER)
+    #if UINTPTR_MAX == UINT64_MAX
+        #define XCP_UTL_SINGLE_LOAD_MAX     (8)
+    #else
+        #define XCP_UTL_SINGLE_LOAD_MAX     (4)
+    #endif /* UINTPTR_MAX */
+#else
+    #define XCP_UTL_SINGLE_LOAD_MAX         (0)
+#endif /* C11_COMPILER */
+
 void XcpUtl_MemCopy(void * dst, void const * src, uint32_t len);
+void XcpUtl_SampleCopy(void * dst, void const * src, uint32_t len);
 void XcpUtl_MemSet(void * dest, uint8_t fill_char, uint32_t len);
 bool XcpUtl_MemCmp(void const * dst, void const * src, uint32_t len);
 void XcpUtl_Hexdump(uint8_t const * buf, uint16_t sz);
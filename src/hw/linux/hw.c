@@ -40,6 +40,17 @@
 #include "xcp_hw.h"
 #include "xcp_tui.h"
 
+#if XCP_DAQ_ENABLE_TRANSMIT_TASK == XCP_ON
+#include <sys/eventfd.h>
+#include <unistd.h>
+#endif /* XCP_DAQ_ENABLE_TRANSMIT_TASK */
+
+#if XCP_DAQ_ENABLE_LOCKED_DTO_BUFFER == XCP_ON
+#include <stdint.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif /* XCP_DAQ_ENABLE_LOCKED_DTO_BUFFER */
+
 /*
 **  Local Types.
 */
@@ -98,7 +109,7 @@ void exitFunc(void);
 /*
 ** Global Variables.
 */
-pthread_t XcpHw_ThreadID[4];
+pthread_t XcpHw_ThreadID[5];
 
 
 /*
@@ -127,6 +138,10 @@ static unsigned long long XcpHw_FreeRunningCounter = 0ULL;
 
 static XcpHw_ApplicationStateType XcpHw_ApplicationState = {PTHREAD_MUTEX_INITIALIZER, PTHREAD_COND_INITIALIZER, 0, {0}};
 
+#if XCP_DAQ_ENABLE_TRANSMIT_TASK == XCP_ON
+static int XcpHw_TransmitEvent = -1;
+#endif /* XCP_DAQ_ENABLE_TRANSMIT_TASK */
+
 /*
 **  Global Functions.
 */
@@ -203,6 +218,13 @@ void XcpHw_Init(void)
 
     XcpHw_FreeRunningCounter = 0ULL;
 
+#if XCP_DAQ_ENABLE_TRANSMIT_TASK == XCP_ON
+    XcpHw_TransmitEvent = eventfd(0, EFD_CLOEXEC);
+    if (XcpHw_TransmitEvent == -1) {
+        XcpHw_ErrorMsg("XcpHw_Init::eventfd()", errno);
+    }
+#endif /* XCP_DAQ_ENABLE_TRANSMIT_TASK */
+
     if (clock_getres(CLOCK_MONOTONIC_RAW, &XcpHw_TimerResolution) == -1) {
         XcpHw_ErrorMsg("XcpHw_Init::clock_getres()", errno);
     }
@@ -261,6 +283,9 @@ void XcpHw_Deinit(void)
 {
     XcpTui_Deinit();
     XcpHw_DeinitLocks();
+#if XCP_DAQ_ENABLE_TRANSMIT_TASK == XCP_ON
+    close(XcpHw_TransmitEvent);
+#endif /* XCP_DAQ_ENABLE_TRANSMIT_TASK */
 }
 
 void XcpHw_SignalApplicationState(uint32_t state, uint8_t signal_all)
@@ -446,6 +471,54 @@ void XcpHw_ReleaseLock(uint8_t lockIdx)
     pthread_mutex_unlock(&XcpHw_Locks[lockIdx]);
 }
 
+#if XCP_DAQ_ENABLE_TRANSMIT_TASK == XCP_ON
+void XcpHw_WaitTransmitRequest(void)
+{
+    uint64_t count = 0ULL;
+
+    /* Reading resets the counter, requests signalled in the meantime coalesce into one wake-up. */
+    while (read(XcpHw_TransmitEvent, &count, sizeof(count)) == -1) {
+        if (errno != EINTR) {
+            XcpHw_ErrorMsg("XcpHw_WaitTransmitRequest::read()", errno);
+            return;
+        }
+    }
+}
+
+void XcpHw_SignalTransmitRequest(void)
+{
+    uint64_t const count = 1ULL;
+
+    if (write(XcpHw_TransmitEvent, &count, sizeof(count)) == -1) {
+        XcpHw_ErrorMsg("XcpHw_SignalTransmitRequest::write()", errno);
+    }
+}
+#endif /* XCP_DAQ_ENABLE_TRANSMIT_TASK */
+
+#if XCP_DAQ_ENABLE_LOCKED_DTO_BUFFER == XCP_ON
+/** @brief Keep a memory region resident, so the DAQ hot path never page-faults.
+ *
+ *  Requires CAP_IPC_LOCK or a sufficient RLIMIT_MEMLOCK (`ulimit -l`).
+ */
+bool XcpHw_LockMemory(void * address, uint32_t size)
+{
+    uintptr_t const pageSize = (uintptr_t)sysconf(_SC_PAGESIZE);
+    uintptr_t const begin = (uintptr_t)address & ~(pageSize - 1);
+    uintptr_t const end = ((uintptr_t)address + size + pageSize - 1) & ~(pageSize - 1);
+
+#if defined(MADV_HUGEPAGE)
+    /* Advisory only: transparent huge pages save TLB entries on multi-megabyte buffers. */
+    (void)madvise((void *)begin, end - begin, MADV_HUGEPAGE);
+#endif /* MADV_HUGEPAGE */
+    /* Faults in all pages of the region. */
+    if (mlock((void *)begin, end - begin) == -1) {
+        XcpHw_ErrorMsg("XcpHw_LockMemory::mlock()", errno);
+        return (bool)XCP_FALSE;
+    }
+    return (bool)XCP_TRUE;
+}
+#endif /* XCP_DAQ_ENABLE_LOCKED_DTO_BUFFER */
+
 #if 0
 DWORD XcpHw_UIThread()
 {
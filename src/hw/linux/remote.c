@@ -0,0 +1,125 @@
+/*
+ * BlueParrot XCP
+ *
+ * (C) 2007-2021 by Christoph Schueler <github.com/Christoph2,
+ *                                      cpu12.gems@googlemail.com>
+ *
+ * All Rights Reserved
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * s. FLOSS-EXCEPTION.txt
+ */
+
+/*
+**  Memory of another process, selected by address extension XCP_REMOTE_MEMORY_ADDRESS_EXTENSION.
+**
+**  Requires ptrace access to the target, i.e. the same user and, with Yama `ptrace_scope` 1,
+**  the target to be a descendant (or to call `prctl(PR_SET_PTRACER, ...)`).
+*/
+
+#define _GNU_SOURCE     /* process_vm_readv() */
+
+#include <sys/types.h>
+#include <sys/uio.h>
+
+#include "xcp.h"
+#include "xcp_hw.h"
+
+#if XCP_ENABLE_REMOTE_MEMORY == XCP_ON
+
+/*
+**  Local Defines.
+*/
+#define XCP_HW_REMOTE_MAX_IOV   (64)    /* Segments per system call, far below IOV_MAX. */
+
+/*
+**  Local Variables.
+*/
+static pid_t XcpHw_RemotePid = (pid_t)0;
+static uintptr_t XcpHw_RemoteBase = (uintptr_t)0;
+
+/** @brief Select the target process of remote memory accesses.
+ *
+ *  Remote addresses are offsets from `base`, so targets with an address space exceeding
+ *  32 bits are reachable.
+ *
+ * @param[in] pid   0 detaches, any access fails then.
+ * @param[in] base
+ */
+void XcpHw_SetRemoteProcess(int32_t pid, uintptr_t base)
+{
+    XcpHw_RemotePid = (pid_t)pid;
+    XcpHw_RemoteBase = base;
+}
+
+/** @brief Gather segments of target memory into one local buffer.
+ *
+ *  One system call per XCP_HW_REMOTE_MAX_IOV segments, i.e. typically per ODT.
+ *
+ * @return XCP_FALSE if not all bytes could be read.
+ */
+bool XcpHw_ReadRemoteMemory(uint8_t * dst, XcpHw_RemoteSegmentType const * segments, uint16_t numSegments)
+{
+    struct iovec local;
+    struct iovec remote[XCP_HW_REMOTE_MAX_IOV];
+    uint16_t count = UINT16(0);
+    uint16_t idx = UINT16(0);
+    size_t length = 0;
+
+    if (XcpHw_RemotePid == (pid_t)0) {
+        return (bool)XCP_FALSE;
+    }
+    while (numSegments > UINT16(0)) {
+        count = XCP_MIN(numSegments, UINT16(XCP_HW_REMOTE_MAX_IOV));
+        length = 0;
+        for (idx = UINT16(0); idx < count; ++idx) {
+            remote[idx].iov_base = (void *)(XcpHw_RemoteBase + segments[idx].address);
+            remote[idx].iov_len = (size_t)segments[idx].length;
+            length += (size_t)segments[idx].length;
+        }
+        local.iov_base = (void *)dst;
+        local.iov_len = length;
+        /* Partial reads (segment crossing into an unmapped page) count as failure. */
+        if (process_vm_readv(XcpHw_RemotePid, &local, 1UL, remote, (unsigned long)count, 0UL) != (ssize_t)length) {
+            return (bool)XCP_FALSE;
+        }
+        dst += length;
+        segments += count;
+        numSegments -= count;
+    }
+    return (bool)XCP_TRUE;
+}
+
+/** @brief Write a local buffer to target memory.
+ *
+ * @return XCP_FALSE if not all bytes could be written.
+ */
+bool XcpHw_WriteRemoteMemory(uint32_t address, uint8_t const * src, uint32_t length)
+{
+    struct iovec local;
+    struct iovec remote;
+
+    if (XcpHw_RemotePid == (pid_t)0) {
+        return (bool)XCP_FALSE;
+    }
+    local.iov_base = (void *)src;
+    local.iov_len = (size_t)length;
+    remote.iov_base = (void *)(XcpHw_RemoteBase + address);
+    remote.iov_len = (size_t)length;
+    return process_vm_writev(XcpHw_RemotePid, &local, 1UL, &remote, 1UL, 0UL) == (ssize_t)length;
+}
+
+#endif /* XCP_ENABLE_REMOTE_MEMORY */
@@ -53,6 +53,9 @@ static WINDOW *create_newwin(int height, int width, int starty, int startx);
 static void destroy_win(WINDOW *local_win);
 static void centered_text(WINDOW * win, int row, char const * text, int attrs);
 static WINDOW * centered_window(int height, int width);
+#if XCP_ENABLE_DAQ_COMMANDS == XCP_ON
+static void show_overruns(WINDOW * win);
+#endif /* XCP_ENABLE_DAQ_COMMANDS */
 
 /*
  * Local Constants.
@@ -64,6 +67,7 @@ static const char TITLE[] = "Blueparrot XCP";
  * Local Variables.
  *
  */
+static WINDOW * status_win = NULL;
 
 static void centered_text(WINDOW * win, int row, char const * text, int attrs)
 {
@@ -79,6 +83,38 @@ static void centered_text(WINDOW * win, int row, char const * text, int attrs)
 }
 
 
+#if XCP_ENABLE_DAQ_COMMANDS == XCP_ON
+/*
+ * Overrun counters: event channels first, then DAQ lists as far as they fit.
+ */
+static void show_overruns(WINDOW * win)
+{
+    XcpDaq_EventType const * event = NULL;
+    XcpDaq_ListIntegerType listCount = 0;
+    XcpDaq_ListIntegerType daqList = 0;
+    unsigned int maxX = 0;
+    unsigned int maxY = 0;
+    int row = 1;
+    uint16_t idx = 0;
+
+    getmaxyx(win, maxY, maxX);
+    mvwprintw(win, row++, 2, "Overruns");
+    for (idx = 0; (idx < XCP_DAQ_MAX_EVENT_CHANNEL) && (row < (int)maxY - 1); ++idx) {
+        event = XcpDaq_GetEventConfiguration(idx);
+        mvwprintw(win, row++, 2, "%-*.*s %10u", (int)maxX - 15, XCP_MIN((int)maxX - 15, (int)event->nameLen),
+                  (char const *)event->name, XcpDaq_GetEventOverruns(idx)
+        );
+    }
+    listCount = XcpDaq_GetListCount();
+    for (daqList = 0; (daqList < listCount) && (row < (int)maxY - 1); ++daqList) {
+        mvwprintw(win, row++, 2, "DAQ list #%-*u %10u", (int)maxX - 25, (unsigned int)daqList, XcpDaq_GetListOverruns(daqList));
+    }
+    wclrtobot(win);
+    box(win, 0 , 0);
+    wrefresh(win);
+}
+#endif /* XCP_ENABLE_DAQ_COMMANDS */
+
 static WINDOW * centered_window(int height, int width)
 {
     return create_newwin(height, width, (LINES - height) / 2, (COLS - width) / 2);
@@ -106,7 +142,6 @@ void XcpTui_Init(void)
 {
     bool ext = FALSE;
     char buf[128];
-    WINDOW * my_win = NULL;
     unsigned int startx = 0U;
     unsigned int starty = 0U;
     unsigned int width = 0U;
@@ -114,6 +149,7 @@ void XcpTui_Init(void)
 
     initscr();
     raw();
+    halfdelay(10);  /* Refresh statistics once per second. */
     keypad(stdscr, TRUE);
     noecho();
     start_color(); /* Start color */
@@ -140,10 +176,10 @@ void XcpTui_Init(void)
     starty = (LINES - height) / 2; /* Calculating for a center placement */
     startx = (COLS - width) / 2; /* of the window */
     refresh();
-    my_win = create_newwin(height, width, starty, startx);
+    status_win = create_newwin(height, width, starty, startx);
     init_pair(2, COLOR_WHITE, COLOR_BLUE);
-    wbkgd(my_win, 2);
-    wrefresh(my_win);
+    wbkgd(status_win, 2);
+    wrefresh(status_win);
 }
 
 void XcpTui_Deinit(void)
@@ -162,6 +198,10 @@ void * XcpTui_MainFunction(void * param)
         ch = getch();
         if (tolower(ch) == 'q') {
             break;
+        } else if (ch == ERR) {
+#if XCP_ENABLE_DAQ_COMMANDS == XCP_ON
+            show_overruns(status_win);
+#endif /* XCP_ENABLE_DAQ_COMMANDS */
         } else {
 #if 0
             mvprintw(20, 10, "The pressed key is ");
@@ -89,6 +89,9 @@ void exitFunc(void);
 */
 static HwStateType HwState = {0};
 static CRITICAL_SECTION XcpHw_Locks[XCP_HW_LOCK_COUNT];
+#if XCP_DAQ_ENABLE_TRANSMIT_TASK == XCP_ON
+static HANDLE XcpHw_TransmitEvent = NULL;
+#endif /* XCP_DAQ_ENABLE_TRANSMIT_TASK */
 
 /*
 **  Global Functions.
@@ -100,11 +103,20 @@ void XcpHw_Init(void)
     //_setmode(_fileno(stdout), _O_U8TEXT);    /* Permit Unicode output on console */
     QueryPerformanceFrequency(&HwState.TicksPerSecond);
     XcpHw_InitLocks();
+#if XCP_DAQ_ENABLE_TRANSMIT_TASK == XCP_ON
+    XcpHw_TransmitEvent = CreateEvent(NULL, FALSE, FALSE, NULL);    /* Auto-reset. */
+    if (XcpHw_TransmitEvent == NULL) {
+        XcpHw_ErrorMsg("XcpHw_Init::CreateEvent()", GetLastError());
+    }
+#endif /* XCP_DAQ_ENABLE_TRANSMIT_TASK */
 }
 
 void XcpHw_Deinit(void)
 {
     XcpHw_DeinitLocks();
+#if XCP_DAQ_ENABLE_TRANSMIT_TASK == XCP_ON
+    CloseHandle(XcpHw_TransmitEvent);
+#endif /* XCP_DAQ_ENABLE_TRANSMIT_TASK */
 }
 
 uint32_t XcpHw_GetTimerCounter(void)
@@ -178,6 +190,43 @@ void XcpHw_ReleaseLock(uint8_t lockIdx)
     LeaveCriticalSection(&XcpHw_Locks[lockIdx]);
 }
 
+#if XCP_DAQ_ENABLE_TRANSMIT_TASK == XCP_ON
+void XcpHw_WaitTransmitRequest(void)
+{
+    if (WaitForSingleObject(XcpHw_TransmitEvent, INFINITE) == WAIT_FAILED) {
+        XcpHw_ErrorMsg("XcpHw_WaitTransmitRequest::WaitForSingleObject()", GetLastError());
+    }
+}
+
+void XcpHw_SignalTransmitRequest(void)
+{
+    if (!SetEvent(XcpHw_TransmitEvent)) {
+        XcpHw_ErrorMsg("XcpHw_SignalTransmitRequest::SetEvent()", GetLastError());
+    }
+}
+#endif /* XCP_DAQ_ENABLE_TRANSMIT_TASK */
+
+#if XCP_DAQ_ENABLE_LOCKED_DTO_BUFFER == XCP_ON
+/** @brief Keep a memory region resident, so the DAQ hot path never page-faults.
+ *
+ *  The working set is grown first, VirtualLock() is limited by its minimum size.
+ */
+bool XcpHw_LockMemory(void * address, uint32_t size)
+{
+    SIZE_T minimum = 0;
+    SIZE_T maximum = 0;
+
+    if (GetProcessWorkingSetSize(GetCurrentProcess(), &minimum, &maximum)) {
+        (void)SetProcessWorkingSetSize(GetCurrentProcess(), minimum + size, maximum + size);
+    }
+    if (!VirtualLock(address, size)) {
+        XcpHw_ErrorMsg("XcpHw_LockMemory::VirtualLock()", GetLastError());
+        return (bool)XCP_FALSE;
+    }
+    return (bool)XCP_TRUE;
+}
+#endif /* XCP_DAQ_ENABLE_LOCKED_DTO_BUFFER */
+
 void XcpHw_ErrorMsg(char * const fun, int errorCode)
 {
     char buffer[1024];
@@ -75,7 +75,7 @@ typedef struct tagXcpTl_ConnectionType {
  } XcpTl_ConnectionType;
 
 
-extern pthread_t XcpHw_ThreadID[4];
+extern pthread_t XcpHw_ThreadID[5];
 
 unsigned char buf[XCP_COMM_BUFLEN];
 socklen_t addrSize = sizeof(struct sockaddr_storage);
@@ -64,6 +64,17 @@ XCP_STATIC Xcp_StateType Xcp_State;
 
 XCP_STATIC Xcp_SendCalloutType Xcp_SendCallout = (Xcp_SendCalloutType)XCP_NULL;
 
+#if XCP_DAQ_ENABLE_RESUME == XCP_ON
+XCP_STATIC uint8_t Xcp_ResumeImage[XCP_DAQ_RESUME_IMAGE_SIZE];
+#endif /* XCP_DAQ_ENABLE_RESUME */
+
+#if XCP_ON_ETHERNET_ENABLE_FRAME_BATCHING == XCP_ON
+/* Outgoing packets, each with its own length/counter header, collected into one datagram/segment. */
+XCP_STATIC uint8_t Xcp_Frame[XCP_ON_ETHERNET_FRAME_SIZE];
+XCP_STATIC uint16_t Xcp_FrameLength = UINT16(0);
+XCP_STATIC uint32_t Xcp_FrameStarted = UINT32(0);   /* XcpHw_GetTimerCounter() at the first packet. */
+#endif /* XCP_ON_ETHERNET_ENABLE_FRAME_BATCHING */
+
 
 void Xcp_WriteMemory(void * dest, void * src, uint16_t count);
 void Xcp_ReadMemory(void * dest, void * src, uint16_t count);
@@ -137,12 +148,20 @@ void Xcp_ReadMemory(void * dest, void * src, uint16_t count);
 */
 XCP_STATIC uint8_t Xcp_SetResetBit8(uint8_t result, uint8_t value, uint8_t flag);
 XCP_STATIC Xcp_MemoryMappingResultType Xcp_MapMemory(Xcp_MtaType const * src, Xcp_MtaType * dst);
-XCP_STATIC void Xcp_Download_Copy(uint32_t address, uint8_t ext, uint32_t len);
+XCP_STATIC bool Xcp_Download_Copy(uint32_t address, uint8_t ext, uint32_t len);
+XCP_STATIC bool Xcp_DownloadMemory(Xcp_MtaType dst, Xcp_MtaType src, uint32_t len);
 XCP_STATIC void Xcp_PositiveResponse(void);
 XCP_STATIC void Xcp_ErrorResponse(uint8_t errorCode);
 XCP_STATIC void Xcp_BusyResponse(void);
 XCP_STATIC bool Xcp_IsProtected(uint8_t resource);
 XCP_STATIC void Xcp_DefaultResourceProtection(void);
+#if XCP_DAQ_ENABLE_RESUME == XCP_ON
+XCP_STATIC void Xcp_Resume(void);
+#endif /* XCP_DAQ_ENABLE_RESUME */
+#if XCP_ON_ETHERNET_ENABLE_FRAME_BATCHING == XCP_ON
+XCP_STATIC void Xcp_AppendToFrame(uint8_t const * data, uint16_t len);
+XCP_STATIC void Xcp_SendFrame(void);
+#endif /* XCP_ON_ETHERNET_ENABLE_FRAME_BATCHING */
 
 #if XCP_ENABLE_SLAVE_BLOCKMODE == XCP_ON
 XCP_STATIC bool Xcp_SlaveBlockTransferIsActive(void);
@@ -235,6 +254,7 @@ XCP_STATIC void Xcp_CopyCalPage_Res(Xcp_PDUType const * const pdu);
 XCP_STATIC void Xcp_ClearDaqList_Res(Xcp_PDUType const * const pdu);
 XCP_STATIC void Xcp_SetDaqPtr_Res(Xcp_PDUType const * const pdu);
 XCP_STATIC void Xcp_WriteDaq_Res(Xcp_PDUType const * const pdu);
+XCP_STATIC void Xcp_WriteDaqEntry(XcpDaq_ODTEntryType * entry, uint8_t bitOffset, uint8_t elemSize, uint8_t addrExt, uint32_t address);
 XCP_STATIC void Xcp_SetDaqListMode_Res(Xcp_PDUType const * const pdu);
 XCP_STATIC void Xcp_GetDaqListMode_Res(Xcp_PDUType const * const pdu);
 XCP_STATIC void Xcp_StartStopDaqList_Res(Xcp_PDUType const * const pdu);
@@ -626,6 +646,9 @@ void Xcp_Init(void)
     Xcp_State.daqProcessor.state = XCP_DAQ_STATE_STOPPED;
     XcpDaq_SetPointer(0, 0, 0);
 #endif /* XCP_ENABLE_DAQ_COMMANDS */
+#if XCP_DAQ_ENABLE_RESUME == XCP_ON
+    Xcp_Resume();
+#endif /* XCP_DAQ_ENABLE_RESUME */
 #if XCP_ENABLE_PGM_COMMANDS == XCP_ON
     Xcp_State.pgmProcessor.state = XCP_PGM_STATE_UNINIT;
 #endif /* ENABLE_PGM_COMMANDS */
@@ -671,14 +694,46 @@ void Xcp_Disconnect(void)
     XcpTl_ReleaseConnection();
     Xcp_DefaultResourceProtection();
     XcpDaq_Init();
+#if XCP_DAQ_ENABLE_RESUME == XCP_ON
+    Xcp_State.sessionStatus &= UINT8(~RESUME);
+#endif /* XCP_DAQ_ENABLE_RESUME */
 }
 
 
+#if XCP_DAQ_ENABLE_RESUME == XCP_ON
+/** @brief Restore the DAQ configuration stored by SET_REQUEST and restart its resume lists.
+ *
+ *  Called from @ref Xcp_Init, so measurement continues after power-up without a master.
+ */
+XCP_STATIC void Xcp_Resume(void)
+{
+    uint8_t const * image = XCP_NULL;
+    uint32_t length = UINT32(0);
+    uint16_t sessionConfigurationId = UINT16(0);
+
+    if (!Xcp_HookFunction_LoadDaq(&image, &length)) {
+        return;
+    }
+    if (!XcpDaq_RestoreConfiguration(image, length, &sessionConfigurationId)) {
+        DBG_PRINT1("Stored DAQ configuration is invalid -- not resumed.\n");
+        return;
+    }
+    Xcp_State.sessionConfigurationId = sessionConfigurationId;
+    if (Xcp_State.daqProcessor.state == XCP_DAQ_STATE_RUNNING) {
+        Xcp_State.sessionStatus |= RESUME;
+    }
+}
+#endif /* XCP_DAQ_ENABLE_RESUME */
+
+
 void Xcp_MainFunction(void)
 {
-#if XCP_ENABLE_DAQ_COMMANDS == XCP_ON
-    XcpDaq_MainFunction();
+#if (XCP_ENABLE_DAQ_COMMANDS == XCP_ON) && (XCP_DAQ_ENABLE_TRANSMIT_TASK == XCP_OFF)
+    XcpDaq_MainFunction();  /* Otherwise DTOs are sent by XcpDaq_TransmitMainFunction(). */
 #endif /* XCP_ENABLE_DAQ_COMMANDS */
+#if XCP_ON_ETHERNET_ENABLE_FRAME_BATCHING == XCP_ON
+    Xcp_FlushFrame();   /* Partial frames the transmit task left behind. */
+#endif /* XCP_ON_ETHERNET_ENABLE_FRAME_BATCHING */
 
 #if 0
     #if XCP_ENABLE_SLAVE_BLOCKMODE == XCP_ON
@@ -705,35 +760,127 @@ Xcp_MtaType Xcp_GetNonPagedAddress(void const * const ptr)
     return mta;
 }
 
-void Xcp_SendPdu(void)
+XCP_STATIC void Xcp_SetTransportLayerHeader(uint8_t * frame, uint16_t len)
 {
-#if XCP_TRANSPORT_LAYER_LENGTH_SIZE != 0
-    const uint16_t len = Xcp_PduOut.len;
-#endif /* XCP_TRANSPORT_LAYER_LENGTH_SIZE */
-
 #if XCP_TRANSPORT_LAYER_LENGTH_SIZE == 1
-    Xcp_PduOut.data[0] = XCP_LOBYTE(len);
+    frame[0] = XCP_LOBYTE(len);
 #elif XCP_TRANSPORT_LAYER_LENGTH_SIZE == 2
-    Xcp_PduOut.data[0] = XCP_LOBYTE(len);
-    Xcp_PduOut.data[1] = XCP_HIBYTE(len);
+    frame[0] = XCP_LOBYTE(len);
+    frame[1] = XCP_HIBYTE(len);
 #endif /* XCP_TRANSPORT_LAYER_LENGTH_SIZE */
 
 #if XCP_TRANSPORT_LAYER_COUNTER_SIZE == 1
-    Xcp_PduOut.data[XCP_TRANSPORT_LAYER_LENGTH_SIZE] = XCP_LOBYTE(Xcp_State.counter);
+    frame[XCP_TRANSPORT_LAYER_LENGTH_SIZE] = XCP_LOBYTE(Xcp_State.counter);
     Xcp_State.counter++;
 #elif XCP_TRANSPORT_LAYER_COUNTER_SIZE == 2
-    Xcp_PduOut.data[XCP_TRANSPORT_LAYER_LENGTH_SIZE] = XCP_LOBYTE(Xcp_State.counter);
-    Xcp_PduOut.data[XCP_TRANSPORT_LAYER_LENGTH_SIZE + 1] = XCP_HIBYTE(Xcp_State.counter);
+    frame[XCP_TRANSPORT_LAYER_LENGTH_SIZE] = XCP_LOBYTE(Xcp_State.counter);
+    frame[XCP_TRANSPORT_LAYER_LENGTH_SIZE + 1] = XCP_HIBYTE(Xcp_State.counter);
     Xcp_State.counter++;
 #endif /* XCP_TRANSPORT_LAYER_COUNTER_SIZE */
+}
 
+void Xcp_SendPdu(void)
+{
 #if XCP_ENABLE_STATISTICS == XCP_ON
     Xcp_State.statistics.crosSend++;
 #endif /* XCP_ENABLE_STATISTICS */
 
+#if XCP_ON_ETHERNET_ENABLE_FRAME_BATCHING == XCP_ON
+    /* Responses are never delayed, DTOs batched so far go along with them. */
+    XCP_TL_ENTER_CRITICAL();
+    Xcp_AppendToFrame(&Xcp_PduOut.data[XCP_TRANSPORT_LAYER_BUFFER_OFFSET], Xcp_PduOut.len);
+    Xcp_SendFrame();
+    XCP_TL_LEAVE_CRITICAL();
+#else
+    Xcp_SetTransportLayerHeader(Xcp_PduOut.data, Xcp_PduOut.len);
     XcpTl_Send(Xcp_PduOut.data, Xcp_PduOut.len + (uint16_t)XCP_TRANSPORT_LAYER_BUFFER_OFFSET);
+#endif /* XCP_ON_ETHERNET_ENABLE_FRAME_BATCHING */
 }
 
+#if XCP_ENABLE_DAQ_COMMANDS == XCP_ON
+/** @brief Send a DTO straight from the DAQ queue.
+ *
+ *  The transport layer header is written into the space the queue keeps in front of `msg->data`.
+ *
+ * @param[in] msg   Message returned by @ref XcpDaq_PeekMessage.
+ */
+void Xcp_SendDto(XcpDaq_MessageType const * msg)
+{
+#if XCP_ON_ETHERNET_ENABLE_FRAME_BATCHING == XCP_OFF
+    uint8_t * frame = (uint8_t *)msg->data - XCP_TRANSPORT_LAYER_BUFFER_OFFSET;
+#endif /* XCP_ON_ETHERNET_ENABLE_FRAME_BATCHING */
+
+#if XCP_DAQ_ENABLE_RESUME == XCP_ON
+    if (Xcp_State.connected == (bool)XCP_FALSE) {
+        return; /* Resumed lists run before a master connects; there is no peer to send to yet. */
+    }
+#endif /* XCP_DAQ_ENABLE_RESUME */
+#if XCP_ON_ETHERNET_ENABLE_FRAME_BATCHING == XCP_ON
+    XCP_TL_ENTER_CRITICAL();
+    Xcp_AppendToFrame(msg->data, UINT16(msg->dlc));
+    XCP_TL_LEAVE_CRITICAL();
+#else
+    Xcp_SetTransportLayerHeader(frame, UINT16(msg->dlc));
+    XcpTl_Send(frame, UINT16(msg->dlc) + (uint16_t)XCP_TRANSPORT_LAYER_BUFFER_OFFSET);
+#endif /* XCP_ON_ETHERNET_ENABLE_FRAME_BATCHING */
+}
+#endif /* XCP_ENABLE_DAQ_COMMANDS */
+
+#if XCP_ON_ETHERNET_ENABLE_FRAME_BATCHING == XCP_ON
+/** @brief Send the batched packets once XCP_ON_ETHERNET_FLUSH_DEADLINE timer ticks have passed
+ *  since the first of them was queued.
+ *
+ *  Called after the DTO queues are drained and from @ref Xcp_MainFunction.
+ */
+void Xcp_FlushFrame(void)
+{
+    XCP_TL_ENTER_CRITICAL();
+#if XCP_ON_ETHERNET_FLUSH_DEADLINE == 0
+    Xcp_SendFrame();
+#else
+    if ((Xcp_FrameLength > UINT16(0)) &&
+        ((XcpHw_GetTimerCounter() - Xcp_FrameStarted) >= UINT32(XCP_ON_ETHERNET_FLUSH_DEADLINE))) {
+        Xcp_SendFrame();
+    }
+#endif /* XCP_ON_ETHERNET_FLUSH_DEADLINE */
+    XCP_TL_LEAVE_CRITICAL();
+}
+
+
+/** @brief Add a packet to the current frame, sending the frame first if the packet doesn't fit.
+ *
+ *  Caller must hold the transport layer lock.
+ */
+XCP_STATIC void Xcp_AppendToFrame(uint8_t const * data, uint16_t len)
+{
+    uint16_t const size = len + UINT16(XCP_TRANSPORT_LAYER_BUFFER_OFFSET);
+
+    if ((Xcp_FrameLength + size) > UINT16(XCP_ON_ETHERNET_FRAME_SIZE)) {
+        Xcp_SendFrame();
+    }
+#if XCP_ON_ETHERNET_FLUSH_DEADLINE != 0
+    if (Xcp_FrameLength == UINT16(0)) {
+        Xcp_FrameStarted = XcpHw_GetTimerCounter();
+    }
+#endif /* XCP_ON_ETHERNET_FLUSH_DEADLINE */
+    Xcp_SetTransportLayerHeader(&Xcp_Frame[Xcp_FrameLength], len);
+    XcpUtl_MemCopy(&Xcp_Frame[Xcp_FrameLength + UINT16(XCP_TRANSPORT_LAYER_BUFFER_OFFSET)], data, UINT32(len));
+    Xcp_FrameLength += size;
+}
+
+
+/** @brief Hand the current frame to the transport layer, caller must hold the transport layer lock.
+ *
+ */
+XCP_STATIC void Xcp_SendFrame(void)
+{
+    if (Xcp_FrameLength > UINT16(0)) {
+        XcpTl_Send(Xcp_Frame, Xcp_FrameLength);
+        Xcp_FrameLength = UINT16(0);
+    }
+}
+#endif /* XCP_ON_ETHERNET_ENABLE_FRAME_BATCHING */
+
 
 uint8_t * Xcp_GetOutPduPtr(void)
 {
@@ -891,6 +1038,15 @@ void Xcp_DispatchCommand(Xcp_PDUType const * const pdu)
 
     if (Xcp_State.connected == (bool)XCP_TRUE) {
         /*DBG_PRINT2("CMD: [%02X]\n", cmd); */
+#if XCP_ENABLE_STIM == XCP_ON
+        if (cmd <= XCP_PID_STIM_MAX) {
+            /* STIM DTOs are not answered. */
+            if (!Xcp_IsProtected(XCP_RESOURCE_STIM)) {
+                XcpDaq_ReceiveStim(pdu->data, pdu->len);
+            }
+            return;
+        }
+#endif /* XCP_ENABLE_STIM */
 
         if (Xcp_IsBusy()) {
             Xcp_BusyResponse();
@@ -1008,15 +1164,24 @@ XCP_STATIC void Xcp_GetStatus_Res(Xcp_PDUType const * const pdu)
     DBG_TRACE1("GET_STATUS\n");
 
     Xcp_Send8(UINT8(6), UINT8(0xff),
+#if XCP_DAQ_ENABLE_RESUME == XCP_ON
+        Xcp_State.sessionStatus,    /* Current session status */
+#else
         UINT8(0),     /* Current session status */
+#endif /* XCP_DAQ_ENABLE_RESUME */
 #if XCP_ENABLE_RESOURCE_PROTECTION == XCP_ON
         Xcp_State.resourceProtection,  /* Current resource protection status */
 #else
         UINT8(0x00),  /* Everything is unprotected. */
 #endif /* XCP_ENABLE_RESOURCE_PROTECTION */
         UINT8(0x00),  /* Reserved */
+#if XCP_DAQ_ENABLE_RESUME == XCP_ON
+        XCP_LOBYTE(Xcp_State.sessionConfigurationId),   /* Session configuration id */
+        XCP_HIBYTE(Xcp_State.sessionConfigurationId),   /* "                      " */
+#else
         UINT8(0),     /* Session configuration id */
         UINT8(0),     /* "                      " */
+#endif /* XCP_DAQ_ENABLE_RESUME */
         UINT8(0), UINT8(0)
     );
 }
@@ -1098,6 +1263,62 @@ XCP_STATIC void Xcp_GetId_Res(Xcp_PDUType const * const pdu)
 #endif /* XCP_ENABLE_GET_ID */
 
 
+#if XCP_ENABLE_SET_REQUEST == XCP_ON
+XCP_STATIC void Xcp_SetRequest_Res(Xcp_PDUType const * const pdu)
+{
+    uint8_t mode = Xcp_GetByte(pdu, UINT8(1));
+    uint16_t sessionConfigurationId = Xcp_GetWord(pdu, UINT8(2));
+#if XCP_DAQ_ENABLE_RESUME == XCP_ON
+    uint8_t const storeModes = XCP_STORE_DAQ_REQ_RESUME | XCP_STORE_DAQ_REQ_NO_RESUME;
+    uint32_t length = UINT32(0);
+#endif /* XCP_DAQ_ENABLE_RESUME */
+
+    DBG_TRACE3("SET_REQUEST [mode: 0x%02x session-id: 0x%04x]\n", mode, sessionConfigurationId);
+    XCP_ASSERT_PGM_IDLE();
+
+#if XCP_DAQ_ENABLE_RESUME == XCP_ON
+    XCP_ASSERT_UNLOCKED(XCP_RESOURCE_DAQ);
+    /* Calibration data is not stored; STORE_DAQ_REQ_RESUME and _NO_RESUME are mutually exclusive. */
+    if (((mode & UINT8(~(storeModes | XCP_CLEAR_DAQ_REQ))) != UINT8(0)) || ((mode & storeModes) == storeModes)) {
+        Xcp_ErrorResponse(UINT8(ERR_OUT_OF_RANGE));
+        return;
+    }
+    if ((mode & XCP_CLEAR_DAQ_REQ) == XCP_CLEAR_DAQ_REQ) {
+        if (!Xcp_HookFunction_ClearDaq()) {
+            Xcp_ErrorResponse(UINT8(ERR_GENERIC));
+            return;
+        }
+        Xcp_State.sessionConfigurationId = UINT16(0);
+    }
+    if ((mode & storeModes) != UINT8(0)) {
+        length = XcpDaq_StoreConfiguration(Xcp_ResumeImage, UINT32(XCP_DAQ_RESUME_IMAGE_SIZE),
+            (bool)((mode & XCP_STORE_DAQ_REQ_RESUME) == XCP_STORE_DAQ_REQ_RESUME), sessionConfigurationId
+        );
+        if (length == UINT32(0)) {
+            Xcp_ErrorResponse(UINT8(ERR_MEMORY_OVERFLOW));
+            return;
+        }
+        if (!Xcp_HookFunction_StoreDaq(Xcp_ResumeImage, length)) {
+            Xcp_ErrorResponse(UINT8(ERR_GENERIC));
+            return;
+        }
+        Xcp_State.sessionConfigurationId = sessionConfigurationId;
+    }
+    /* Requests are carried out synchronously, so they are already finished when acknowledged. */
+    Xcp_PositiveResponse();
+    if ((mode & XCP_CLEAR_DAQ_REQ) == XCP_CLEAR_DAQ_REQ) {
+        Xcp_Send8(UINT8(2), XCP_PID_EV, XCP_EV_CLEAR_DAQ, UINT8(0), UINT8(0), UINT8(0), UINT8(0), UINT8(0), UINT8(0));
+    }
+    if ((mode & storeModes) != UINT8(0)) {
+        Xcp_Send8(UINT8(2), XCP_PID_EV, XCP_EV_STORE_DAQ, UINT8(0), UINT8(0), UINT8(0), UINT8(0), UINT8(0), UINT8(0));
+    }
+#else
+    Xcp_ErrorResponse(UINT8(ERR_OUT_OF_RANGE));
+#endif /* XCP_DAQ_ENABLE_RESUME */
+}
+#endif /* XCP_ENABLE_SET_REQUEST */
+
+
 #if XCP_ENABLE_GET_SEED == XCP_ON
 XCP_STATIC void Xcp_GetSeed_Res(Xcp_PDUType const * const pdu)
 {
@@ -1368,7 +1589,10 @@ XCP_STATIC void Xcp_Download_Res(Xcp_PDUType const * const pdu)
         /* OK, regular first-frame transfer. */
         Xcp_State.masterBlockModeState.blockTransferActive = (bool)XCP_TRUE;
         Xcp_State.masterBlockModeState.remaining = len - XCP_DOWNLOAD_PAYLOAD_LENGTH;
-        Xcp_Download_Copy(UINT32(pdu->data + 2), UINT8(0), UINT32(XCP_DOWNLOAD_PAYLOAD_LENGTH));
+        if (!Xcp_Download_Copy(UINT32(pdu->data + 2), UINT8(0), UINT32(XCP_DOWNLOAD_PAYLOAD_LENGTH))) {
+            Xcp_State.masterBlockModeState.blockTransferActive = (bool)XCP_FALSE;
+            Xcp_ErrorResponse(UINT8(ERR_ACCESS_DENIED));
+        }
         return;
     }
 #endif /* XCP_ENABLE_MASTER_BLOCKMODE */
@@ -1379,7 +1603,10 @@ XCP_STATIC void Xcp_Download_Res(Xcp_PDUType const * const pdu)
         return;
     }
 #endif
-    Xcp_Download_Copy(UINT32(pdu->data + 2), UINT8(0), UINT32(len));
+    if (!Xcp_Download_Copy(UINT32(pdu->data + 2), UINT8(0), UINT32(len))) {
+        Xcp_ErrorResponse(UINT8(ERR_ACCESS_DENIED));
+        return;
+    }
     Xcp_PositiveResponse();
 }
 
@@ -1399,7 +1626,11 @@ XCP_STATIC void Xcp_DownloadNext_Res(Xcp_PDUType const * const pdu)
         return;
     }
     len = XCP_MIN(remaining, XCP_DOWNLOAD_PAYLOAD_LENGTH);
-    Xcp_Download_Copy(UINT32(pdu->data + 2), UINT8(0), UINT32(len));
+    if (!Xcp_Download_Copy(UINT32(pdu->data + 2), UINT8(0), UINT32(len))) {
+        Xcp_State.masterBlockModeState.blockTransferActive = (bool)XCP_FALSE;
+        Xcp_ErrorResponse(UINT8(ERR_ACCESS_DENIED));
+        return;
+    }
     Xcp_State.masterBlockModeState.remaining -= len;
     if (Xcp_State.masterBlockModeState.remaining == UINT8(0)) {
         Xcp_State.masterBlockModeState.blockTransferActive = (bool)XCP_FALSE;
@@ -1417,7 +1648,10 @@ XCP_STATIC void Xcp_DownloadMax_Res(Xcp_PDUType const * const pdu)
     DBG_TRACE1("DOWNLOAD_MAX\n");
 
     XCP_ASSERT_PGM_IDLE();
-    Xcp_Download_Copy(UINT32(pdu->data + 1), UINT8(0), UINT32(XCP_DOWNLOAD_PAYLOAD_LENGTH + 1));
+    if (!Xcp_Download_Copy(UINT32(pdu->data + 1), UINT8(0), UINT32(XCP_DOWNLOAD_PAYLOAD_LENGTH + 1))) {
+        Xcp_ErrorResponse(UINT8(ERR_ACCESS_DENIED));
+        return;
+    }
     Xcp_PositiveResponse();
 
 }
@@ -1445,7 +1679,10 @@ XCP_STATIC void Xcp_ShortDownload_Res(Xcp_PDUType const * const pdu)
 
     src.address = (uint32_t)pdu->data + 8;
     src.ext = UINT8(0);
-    Xcp_CopyMemory(dst, src, (uint32_t)len);
+    if (!Xcp_DownloadMemory(dst, src, (uint32_t)len)) {
+        Xcp_ErrorResponse(UINT8(ERR_ACCESS_DENIED));
+        return;
+    }
 
     XCP_INCREMENT_MTA(len);
 
@@ -1523,6 +1760,18 @@ XCP_STATIC void Xcp_SetDaqPtr_Res(Xcp_PDUType const * const pdu)
     Xcp_PositiveResponse();
 }
 
+XCP_STATIC void Xcp_WriteDaqEntry(XcpDaq_ODTEntryType * entry, uint8_t bitOffset, uint8_t elemSize, uint8_t addrExt, uint32_t address)
+{
+#if XCP_DAQ_ENABLE_BIT_OFFSET == XCP_ON
+    entry->bitOffset = bitOffset;
+#endif /* XCP_DAQ_ENABLE_BIT_OFFSET */
+    entry->length = elemSize;
+    entry->mta.address = address;
+#if XCP_DAQ_ENABLE_ADDR_EXT == XCP_ON
+    entry->mta.ext = addrExt;
+#endif /* XCP_DAQ_ENABLE_ADDR_EXT */
+}
+
 XCP_STATIC void Xcp_WriteDaq_Res(Xcp_PDUType const * const pdu)
 {
     XcpDaq_ODTEntryType * entry = XCP_NULL;
@@ -1546,15 +1795,7 @@ XCP_STATIC void Xcp_WriteDaq_Res(Xcp_PDUType const * const pdu)
 #endif /* XCP_DAQ_ENABLE_PREDEFINED_LISTS */
 
     entry = XcpDaq_GetOdtEntry(Xcp_State.daqPointer.daqList, Xcp_State.daqPointer.odt, Xcp_State.daqPointer.odtEntry);
-
-#if XCP_DAQ_BIT_OFFSET_SUPPORTED == XCP_ON
-    entry->bitOffset = bitOffset;
-#endif /* XCP_DAQ_ENABLE_BIT_OFFSET */
-    entry->length = elemSize;
-    entry->mta.address = address;
-#if XCP_DAQ_ADDR_EXT_SUPPORTED == XCP_ON
-    entry->mta.ext = adddrExt;
-#endif /* XCP_DAQ_ENABLE_ADDR_EXT */
+    Xcp_WriteDaqEntry(entry, bitOffset, elemSize, adddrExt, address);
 
     /* Advance ODT entry pointer within  one  and  the same ODT. After writing to the
     last ODT entry of an ODT, the value of the DAQ pointer is undefined! */
@@ -1594,23 +1835,31 @@ The master is not allowed to set the ALTERNATING flag and the TIMESTAMP flag at
         return;
     }
 #endif /* XCP_DAQ_ENABLE_ALTERNATING */
-#if XCP_DAQ_PRIORITIZATION_SUPPORTED == XCP_OFF
+#if XCP_DAQ_ENABLE_PRIORITIZATION == XCP_OFF
     /* Needs to be 0 */
     if (priority > UINT8(0)) {
         Xcp_ErrorResponse(UINT8(ERR_OUT_OF_RANGE));
         return;
     }
 #endif /* XCP_DAQ_ENABLE_PRIORITIZATION */
-#if XCP_DAQ_PRESCALER_SUPPORTED == XCP_OFF
+#if XCP_DAQ_ENABLE_PRESCALER == XCP_OFF
     /* Needs to be 1 */
     if (prescaler > UINT8(1)) {
         Xcp_ErrorResponse(UINT8(ERR_OUT_OF_RANGE));
         return;
     }
+#else
+    if (prescaler == UINT8(0)) {
+        Xcp_ErrorResponse(UINT8(ERR_OUT_OF_RANGE));
+        return;
+    }
 #endif /* XCP_DAQ_ENABLE_PRESCALER */
 
+    if (!XcpDaq_AddEventChannel(daqListNumber, eventChannelNumber)) {
+        Xcp_ErrorResponse(UINT8(ERR_OUT_OF_RANGE));
+        return;
+    }
     entry = XcpDaq_GetListState(daqListNumber);
-    XcpDaq_AddEventChannel(daqListNumber, eventChannelNumber);
 
     entry->mode = Xcp_SetResetBit8(entry->mode, mode, XCP_DAQ_LIST_MODE_TIMESTAMP);
     entry->mode = Xcp_SetResetBit8(entry->mode, mode, XCP_DAQ_LIST_MODE_ALTERNATING);
@@ -1621,6 +1870,9 @@ The master is not allowed to set the ALTERNATING flag and the TIMESTAMP flag at
 #if XCP_DAQ_ENABLE_PRESCALER == XCP_ON
     entry->prescaler = prescaler;
 #endif /* XCP_DAQ_ENABLE_PRESCALER */
+#if XCP_DAQ_ENABLE_PRIORITIZATION == XCP_ON
+    entry->priority = priority;
+#endif /* XCP_DAQ_ENABLE_PRIORITIZATION */
 
     Xcp_PositiveResponse();
 }
@@ -1676,24 +1928,28 @@ XCP_STATIC void Xcp_StartStopDaqList_Res(Xcp_PDUType const * const pdu)
 XCP_STATIC void Xcp_StartStopSynch_Res(Xcp_PDUType const * const pdu)
 {
     const uint8_t mode = Xcp_GetByte(pdu, UINT8(1));
+    Xcp_ReturnType result = ERR_SUCCESS;
 
     DBG_TRACE2("START_STOP_SYNCH [mode: 0x%02x]\n", mode);
     XCP_ASSERT_PGM_IDLE();
     XCP_ASSERT_UNLOCKED(XCP_RESOURCE_DAQ);
 
     if (mode == START_SELECTED) {
-        XcpDaq_StartSelectedLists();
-        XcpDaq_SetProcessorState(XCP_DAQ_STATE_RUNNING);
+        result = XcpDaq_StartSelectedLists();
+        if (result == ERR_SUCCESS) {
+            XcpDaq_SetProcessorState(XCP_DAQ_STATE_RUNNING);
+        }
     } else if (mode == STOP_ALL) {
-        XcpDaq_StopAllLists();
-        XcpDaq_SetProcessorState(XCP_DAQ_STATE_STOPPED);
+        result = XcpDaq_StopAllLists();
+        if (result == ERR_SUCCESS) {
+            XcpDaq_SetProcessorState(XCP_DAQ_STATE_STOPPED);
+        }
     } else if (mode == STOP_SELECTED) {
-        XcpDaq_StopSelectedLists();
+        result = XcpDaq_StopSelectedLists();
     } else {
-        Xcp_ErrorResponse(UINT8(ERR_OUT_OF_RANGE));
-        return;
+        result = ERR_OUT_OF_RANGE;
     }
-    Xcp_PositiveResponse();
+    Xcp_SendResult(result);
 }
 
 XCP_STATIC void Xcp_GetDaqListMode_Res(Xcp_PDUType const * const pdu)
@@ -1769,6 +2025,9 @@ XCP_STATIC void Xcp_GetDaqListInfo_Res(Xcp_PDUType const * const pdu)
     properties |= DAQ_LIST_PROPERTY_PREDEFINED;     /* Hardcoded for now. */
     properties |= DAQ_LIST_PROPERTY_EVENT_FIXED;    /* "                " */
     properties |= DAQ_LIST_PROPERTY_DAQ;            /* "                " */
+#if XCP_ENABLE_STIM == XCP_ON
+    properties |= DAQ_LIST_PROPERTY_STIM;
+#endif /* XCP_ENABLE_STIM */
 
 #if XCP_DAQ_ENABLE_PREDEFINED_LISTS == XCP_ON
     Xcp_Send8(UINT8(8), UINT8(0xff),
@@ -1788,25 +2047,70 @@ XCP_STATIC void Xcp_GetDaqListInfo_Res(Xcp_PDUType const * const pdu)
 
 
 #if XCP_ENABLE_WRITE_DAQ_MULTIPLE == XCP_ON
-XCP_STATIC void Xcp_WriteDaqMultiple_Res(Xcp_PDUType const * const pdu)
-{
-    XcpDaq_ODTEntryType * entry = XCP_NULL;
-
-    uint8_t numElements = Xcp_GetByte(pdu, UINT8(1));
 /*
-    const uint8_t bitOffset = Xcp_GetByte(pdu, UINT8(1));
-    const uint8_t elemSize  = Xcp_GetByte(pdu, UINT8(2));
-    const uint8_t adddrExt  = Xcp_GetByte(pdu, UINT8(3));
-    const uint32_t address  = Xcp_GetDWord(pdu, UINT8(4));
+**  The whole packet is validated before the first element is written, so the DAQ pointer
+**  range is checked once instead of per ODT entry -- and a rejected packet changes nothing.
 */
+XCP_STATIC void Xcp_WriteDaqMultiple_Res(Xcp_PDUType const * const pdu)
+{
+    const uint8_t numElements = Xcp_GetByte(pdu, UINT8(1));
+    uint16_t lastEntry = UINT16(0);
+    uint8_t bitOffset = UINT8(0);
+    uint8_t offset = UINT8(0);
+    uint8_t idx = UINT8(0);
 
-    DBG_TRACE2("WRITE_DAQ_MULTIPLE [numElements: 0x%08x]\n", numElements);
+    DBG_TRACE2("WRITE_DAQ_MULTIPLE [numElements: %u]\n", numElements);
 
     XCP_ASSERT_DAQ_STOPPED();
     XCP_ASSERT_PGM_IDLE();
     XCP_ASSERT_UNLOCKED(XCP_RESOURCE_DAQ);
+#if XCP_DAQ_ENABLE_PREDEFINED_LISTS == XCP_ON
+    if (Xcp_State.daqPointer.daqList < XcpDaq_PredefinedListCount) {
+        Xcp_SendResult(ERR_WRITE_PROTECTED);
+        return;
+    }
+#endif /* XCP_DAQ_ENABLE_PREDEFINED_LISTS */
+    if ((numElements == UINT8(0)) || (numElements > UINT8(XCP_WRITE_DAQ_MULTIPLE_MAX_ELEMENTS)) ||
+        (pdu->len < (UINT16(XCP_WRITE_DAQ_MULTIPLE_HEADER_SIZE) + (UINT16(numElements) * UINT16(XCP_WRITE_DAQ_MULTIPLE_ELEMENT_SIZE))))) {
+        Xcp_ErrorResponse(UINT8(ERR_CMD_SYNTAX));
+        return;
+    }
+    /* Computed in 16 bits, 8 bit ODT entry numbers would wrap around behind entry 255. */
+    lastEntry = UINT16(Xcp_State.daqPointer.odtEntry) + UINT16(numElements) - UINT16(1);
+    if ((UINT16((XcpDaq_ODTEntryIntegerType)lastEntry) != lastEntry) ||
+        !XcpDaq_ValidateOdtEntry(Xcp_State.daqPointer.daqList, Xcp_State.daqPointer.odt, (XcpDaq_ODTEntryIntegerType)lastEntry)) {
+        Xcp_ErrorResponse(UINT8(ERR_OUT_OF_RANGE));
+        return;
+    }
+    for (idx = UINT8(0); idx < numElements; ++idx) {
+        offset = UINT8(XCP_WRITE_DAQ_MULTIPLE_HEADER_SIZE) + (idx * UINT8(XCP_WRITE_DAQ_MULTIPLE_ELEMENT_SIZE));
+        if ((Xcp_GetByte(pdu, offset + UINT8(1)) == UINT8(0)) || (Xcp_GetByte(pdu, offset + UINT8(1)) > UINT8(XCP_DAQ_MAX_ODT_ENTRY_SIZE))) {
+            Xcp_ErrorResponse(UINT8(ERR_OUT_OF_RANGE));
+            return;
+        }
+        bitOffset = Xcp_GetByte(pdu, offset);
+        /* 0x00 .. 0x1f selects a bit, 0xff means no bit offset. */
+        if ((bitOffset > UINT8(0x1f)) && (bitOffset != UINT8(0xff))) {
+            Xcp_ErrorResponse(UINT8(ERR_OUT_OF_RANGE));
+            return;
+        }
+    }
+
+    for (idx = UINT8(0); idx < numElements; ++idx) {
+        offset = UINT8(XCP_WRITE_DAQ_MULTIPLE_HEADER_SIZE) + (idx * UINT8(XCP_WRITE_DAQ_MULTIPLE_ELEMENT_SIZE));
+        Xcp_WriteDaqEntry(
+            XcpDaq_GetOdtEntry(Xcp_State.daqPointer.daqList, Xcp_State.daqPointer.odt, Xcp_State.daqPointer.odtEntry),
+            Xcp_GetByte(pdu, offset),                   /* Bit offset. */
+            Xcp_GetByte(pdu, offset + UINT8(1)),        /* Size. */
+            Xcp_GetByte(pdu, offset + UINT8(6)),        /* Address extension. */
+            Xcp_GetDWord(pdu, offset + UINT8(2))        /* Address. */
+        );
+        Xcp_State.daqPointer.odtEntry += (XcpDaq_ODTEntryIntegerType)1;
+    }
+
+    Xcp_PositiveResponse();
 }
-#endif // XCP_ENABLE_WRITE_DAQ_MULTIPLE
+#endif /* XCP_ENABLE_WRITE_DAQ_MULTIPLE */
 
 
 #if XCP_ENABLE_FREE_DAQ == XCP_ON
@@ -1914,7 +2218,7 @@ XCP_STATIC void Xcp_GetDaqEventInfo_Res(Xcp_PDUType const * const pdu)
     DBG_TRACE2("GET_DAQ_EVENT_INFO [eventChannel: %d]\n", eventChannel);
     XCP_ASSERT_UNLOCKED(XCP_RESOURCE_DAQ);
 
-    if (eventChannel >= UINT8(XCP_DAQ_MAX_EVENT_CHANNEL)) {
+    if (eventChannel >= UINT16(XCP_DAQ_MAX_EVENT_CHANNEL)) {
         Xcp_SendResult(ERR_OUT_OF_RANGE);
         return;
     }
@@ -1928,11 +2232,11 @@ XCP_STATIC void Xcp_GetDaqEventInfo_Res(Xcp_PDUType const * const pdu)
 
     Xcp_Send8(UINT8(7), UINT8(0xff),
       UINT8(event->properties), /* DAQ_EVENT_PROPERTIES */
-      UINT8(1),                 /* maximum number of DAQ lists in this event channel */
+      UINT8(XCP_DAQ_MAX_LISTS_PER_EVENT),   /* maximum number of DAQ lists in this event channel */
       UINT8(nameLen),           /* EVENT_CHANNEL_NAME_LENGTH in bytes 0 – If not available */
       UINT8(event->cycle),      /* EVENT_CHANNEL_TIME_CYCLE 0 – Not cyclic */
       UINT8(event->timeunit),   /* EVENT_CHANNEL_TIME_UNIT don’t care if Event channel time cycle = 0 */
-      UINT8(0),                 /* EVENT_CHANNEL_PRIORITY (FF highest) */
+      UINT8(event->priority),   /* EVENT_CHANNEL_PRIORITY (FF highest) */
       UINT8(0)
     );
 }
@@ -2138,10 +2442,30 @@ void Xcp_WriteMemory(void * dest, void * src, uint16_t count)
 #if XCP_REPLACE_STD_COPY_MEMORY == XCP_OFF
 void Xcp_CopyMemory(Xcp_MtaType dst, Xcp_MtaType src, uint32_t len)
 {
+#if XCP_ENABLE_REMOTE_MEMORY == XCP_ON
+    XcpHw_RemoteSegmentType segment = {0};
+#endif /* XCP_ENABLE_REMOTE_MEMORY */
 #if XCP_ENABLE_ADDRESS_MAPPER == XCP_ON
     Xcp_MtaType tmpD = {0};
     Xcp_MtaType tmpS = {0};
     Xcp_MemoryMappingResultType res = XCP_MEMORY_ADDRESS_INVALID;
+#endif /* XCP_ENABLE_ADDRESS_MAPPER */
+
+#if XCP_ENABLE_REMOTE_MEMORY == XCP_ON
+    /* Local buffers (PDUs) always have address extension 0. */
+    if (src.ext == UINT8(XCP_REMOTE_MEMORY_ADDRESS_EXTENSION)) {
+        segment.address = src.address;
+        segment.length = len;
+        if (!XcpHw_ReadRemoteMemory((uint8_t *)(uintptr_t)dst.address, &segment, UINT16(1))) {
+            /* Unreadable target memory uploads as zeros. */
+            XcpUtl_MemSet((void *)(uintptr_t)dst.address, UINT8(0), len);
+        }
+        return;
+    }
+    /* Remote destinations are written by Xcp_DownloadMemory(), which reports failures. */
+#endif /* XCP_ENABLE_REMOTE_MEMORY */
+
+#if XCP_ENABLE_ADDRESS_MAPPER == XCP_ON
 
     tmpD.address = dst.address;
     tmpS.address = src.address;
@@ -2283,14 +2607,32 @@ XCP_STATIC Xcp_MemoryMappingResultType Xcp_MapMemory(Xcp_MtaType const * src, Xc
 }
 #endif
 
-XCP_STATIC void Xcp_Download_Copy(uint32_t address, uint8_t ext, uint32_t len)
+XCP_STATIC bool Xcp_Download_Copy(uint32_t address, uint8_t ext, uint32_t len)
 {
     Xcp_MtaType src = {0};
 
     src.address = address;
     src.ext = ext;
-    Xcp_CopyMemory(Xcp_State.mta, src, (uint32_t)len);
+    if (!Xcp_DownloadMemory(Xcp_State.mta, src, (uint32_t)len)) {
+        return (bool)XCP_FALSE;
+    }
     XCP_INCREMENT_MTA(len);
+    return (bool)XCP_TRUE;
+}
+
+/** @brief Copy downloaded data from a PDU to its destination.
+ *
+ * @return XCP_FALSE if target process memory couldn't be written; the MTA stays put.
+ */
+XCP_STATIC bool Xcp_DownloadMemory(Xcp_MtaType dst, Xcp_MtaType src, uint32_t len)
+{
+#if XCP_ENABLE_REMOTE_MEMORY == XCP_ON
+    if (dst.ext == UINT8(XCP_REMOTE_MEMORY_ADDRESS_EXTENSION)) {
+        return XcpHw_WriteRemoteMemory(dst.address, (uint8_t const *)(uintptr_t)src.address, len);
+    }
+#endif /* XCP_ENABLE_REMOTE_MEMORY */
+    Xcp_CopyMemory(dst, src, len);
+    return (bool)XCP_TRUE;
 }
 
 #if XCP_ENABLE_PGM_COMMANDS == XCP_ON
@@ -30,6 +30,17 @@
 #include "xcp.h"
 #include "xcp_util.h"
 
+/* ODT entries select remote memory by their address extension. */
+#if (XCP_ENABLE_REMOTE_MEMORY == XCP_ON) && (XCP_DAQ_ENABLE_ADDR_EXT == XCP_ON)
+#define XCP_DAQ_REMOTE_SAMPLING             XCP_ON
+#else
+#define XCP_DAQ_REMOTE_SAMPLING             XCP_OFF
+#endif /* XCP_ENABLE_REMOTE_MEMORY */
+
+/* A list is sampled by a single event channel, ODTs are identified by an 8-bit PID below the response PIDs. */
+#define XCP_DAQ_GATHER_PLAN_LISTS           XCP_MIN(XCP_DAQ_GATHER_PLAN_SIZE, XCP_DAQ_MAX_EVENT_CHANNEL * XCP_DAQ_MAX_LISTS_PER_EVENT)
+#define XCP_DAQ_GATHER_PLAN_ODTS            XCP_MIN(XCP_DAQ_GATHER_PLAN_SIZE, 0xFC)
+
 
 /*
 ** Local Types.
@@ -59,10 +70,215 @@ typedef enum tagXcpDaq_ListTransitionType {
     DAQ_LIST_TRANSITION_STOP
 } XcpDaq_ListTransitionType;
 
+/*
+**  Gather plans are compiled from the started DAQ lists at START_STOP_SYNCH time,
+**  so XcpDaq_TriggerEvent() doesn't need to walk list/ODT/ODT entry configurations.
+*/
+typedef struct tagXcpDaq_GatherEntryType {
+    uint8_t * address;      /* Sampled (DAQ) or stimulated (STIM) memory. */
+    uint16_t offset;        /* Offset within DTO. */
+    uint16_t length;
+} XcpDaq_GatherEntryType;
+
+typedef struct tagXcpDaq_GatherOdtType {
+    uint16_t firstEntry;
+    uint16_t numEntries;
+    uint16_t length;        /* Total DTO length, including header. */
+    uint8_t pid;
+    uint8_t header;         /* XCP_DAQ_GATHER_HEADER_PID | XCP_DAQ_GATHER_HEADER_TIMESTAMP | XCP_DAQ_GATHER_HEADER_REMOTE */
+#if XCP_ENABLE_STIM == XCP_ON
+    uint16_t stimOffset;    /* Position of the DTO within the data set of a STIM list. */
+#endif /* XCP_ENABLE_STIM */
+#if XCP_DAQ_ENABLE_SEQLOCK == XCP_ON
+    uint16_t snapshotOffset;    /* Position of the DTO within the snapshot pool of the plan. */
+#endif /* XCP_DAQ_ENABLE_SEQLOCK */
+#if XCP_DAQ_ENABLE_PREDEFINED_SAMPLERS == XCP_ON
+    XcpDaq_SampleFunctionType sample;   /* Replaces the entries if not NULL. */
+#endif /* XCP_DAQ_ENABLE_PREDEFINED_SAMPLERS */
+} XcpDaq_GatherOdtType;
+
+#if XCP_ENABLE_STIM == XCP_ON
+#if XCP_DAQ_ENABLE_LOCK_FREE_DTO_QUEUE == XCP_ON
+typedef _Atomic uint8_t XcpDaq_StimSlotType;
+#else
+typedef uint8_t XcpDaq_StimSlotType;
+#endif /* XCP_DAQ_ENABLE_LOCK_FREE_DTO_QUEUE */
+
+/*
+**  Triple buffered data sets of a STIM list: the receiver fills `back`, the event side applies
+**  `front`, and complete sets are handed over by exchanging slots with `middle` -- neither side
+**  ever waits for the other, the latest complete set wins.
+*/
+typedef struct tagXcpDaq_StimBufferType {
+    XcpDaq_StimSlotType middle;     /* Slot index, XCP_DAQ_STIM_SLOT_FRESH if not yet applied. */
+    uint8_t back;                   /* Receiver only. */
+    uint8_t front;                  /* Event channel only. */
+    uint16_t gatherList;
+    uint16_t offset;                /* First slot within the STIM pool of the plan. */
+    uint16_t size;                  /* Size of a slot. */
+    uint32_t received[3];           /* Completion time of a slot. */
+    XcpDaq_StimLatencyType latency; /* Event channel only. */
+} XcpDaq_StimBufferType;
+#endif /* XCP_ENABLE_STIM */
+
+typedef struct tagXcpDaq_GatherListType {
+    XcpDaq_ListIntegerType daqListNumber;
+    uint16_t firstOdt;
+    uint16_t numOdts;
+    uint8_t priority;
+    XcpDaq_ListStateType * state;
+#if XCP_ENABLE_STIM == XCP_ON
+    XcpDaq_StimBufferType * stim;   /* NULL for DAQ lists. */
+#endif /* XCP_ENABLE_STIM */
+} XcpDaq_GatherListType;
+
+typedef struct tagXcpDaq_GatherEventType {
+    uint16_t firstList;
+    uint16_t numLists;
+#if XCP_DAQ_ENABLE_SEQLOCK == XCP_ON
+    XcpDaq_SeqLockType * lock;  /* Sample through a snapshot if not NULL. */
+#endif /* XCP_DAQ_ENABLE_SEQLOCK */
+} XcpDaq_GatherEventType;
+
+/*
+**  Gather plans are double buffered: a new plan is compiled into the inactive buffer and published
+**  as a whole, producers always sample a complete plan. The previous buffer is reused only after
+**  all producers left it, s. XcpDaq_EnterPlan() / XcpDaq_AcquireInactivePlan(). One writer at a time
+**  owns the inactive buffer; it's compiled outside the DAQ critical section.
+*/
+typedef struct tagXcpDaq_GatherPlanType {
+    XcpDaq_GatherEventType events[XCP_DAQ_MAX_EVENT_CHANNEL];
+    XcpDaq_GatherListType lists[XCP_DAQ_GATHER_PLAN_LISTS];
+    XcpDaq_GatherOdtType odts[XCP_DAQ_GATHER_PLAN_ODTS];
+    XcpDaq_GatherEntryType entries[XCP_DAQ_GATHER_PLAN_SIZE];
+    uint16_t listCount;
+    uint16_t odtCount;
+    uint16_t entryCount;
+#if XCP_DAQ_REMOTE_SAMPLING == XCP_ON
+    XcpHw_RemoteSegmentType remoteSegments[XCP_DAQ_GATHER_PLAN_SIZE];  /* Target memory of remote ODTs, indexed like `entries`. */
+#endif /* XCP_DAQ_REMOTE_SAMPLING */
+#if XCP_ENABLE_ADDRESS_MAPPER == XCP_ON
+    Xcp_MtaType sources[XCP_DAQ_GATHER_PLAN_SIZE];  /* Unmapped source of an entry, indexed like `entries`. */
+#endif /* XCP_ENABLE_ADDRESS_MAPPER */
+#if XCP_DAQ_ENABLE_SEQLOCK == XCP_ON
+    uint8_t snapshotPool[XCP_DAQ_SNAPSHOT_BUFFER_SIZE];
+    uint16_t snapshotPoolUsed;
+#endif /* XCP_DAQ_ENABLE_SEQLOCK */
+#if XCP_ENABLE_STIM == XCP_ON
+    XcpDaq_StimBufferType stimBuffers[XCP_DAQ_MAX_STIM_LISTS];
+    uint8_t stimPool[XCP_DAQ_STIM_BUFFER_SIZE];
+    uint8_t stimListCount;
+    uint16_t stimPoolUsed;
+#endif /* XCP_ENABLE_STIM */
+} XcpDaq_GatherPlanType;
+
+#if XCP_DAQ_ENABLE_LOCK_FREE_DTO_QUEUE == XCP_ON
+typedef _Atomic uint8_t XcpDaq_PlanIndexType;
+#else
+typedef uint8_t XcpDaq_PlanIndexType;
+#endif /* XCP_DAQ_ENABLE_LOCK_FREE_DTO_QUEUE */
+
+#if XCP_DAQ_ENABLE_LOCK_FREE_DTO_QUEUE == XCP_ON
+typedef _Atomic uint32_t XcpDaq_DropCountType;
+#else
+typedef uint32_t XcpDaq_DropCountType;
+#endif /* XCP_DAQ_ENABLE_LOCK_FREE_DTO_QUEUE */
+
+typedef struct tagXcpDaq_DtoQueueType {
+    XcpDaq_DtoBufferStateType state;
+    XCP_DAQ_DTO_INDEX_TYPE reserved;    /* Producer only: position of the reserved record. */
+    XcpDaq_DropCountType dropped;   /* Written by producer only, read by the statistics: DTOs lost due to overflow. */
+    uint8_t buffer[XCP_DAQ_DTO_BUFFER_SIZE];
+} XcpDaq_DtoQueueType;
+
 /*
 ** Local Function-like Macros.
 */
-#define XCP_DAQ_MESSAGE_SIZE(msg)   UINT16((((msg)->dlc) + sizeof(uint8_t)))
+/*
+**  Queue record: DLC byte, room for the transport layer header, DTO.
+**  A DLC of zero marks the unused tail of the buffer, the next record starts at offset zero.
+*/
+#define XCP_DAQ_RECORD_SIZE(dlc)    UINT16(UINT16(dlc) + UINT16(1) + UINT16(XCP_TRANSPORT_LAYER_BUFFER_OFFSET))
+#define XCP_DAQ_RECORD_WRAP         UINT8(0)
+
+/* Maps a DAQ list priority (0x00 lowest .. 0xff highest) onto a transmit queue class. */
+#define XCP_DAQ_PRIORITY_CLASS(priority)    UINT8((UINT16(priority) * UINT16(XCP_DAQ_PRIORITY_CLASSES)) >> 8)
+
+/* Naturally aligned members up to XCP_UTL_SINGLE_LOAD_MAX bytes are sampled with a single load, s. XcpUtl_SampleCopy(). */
+#define XCP_DAQ_IS_SINGLE_LOAD(address, length)                                                     \
+    ((((length) == UINT32(2)) || ((length) == UINT32(4)) || ((length) == UINT32(8))) &&            \
+     ((length) <= UINT32(XCP_UTL_SINGLE_LOAD_MAX)) &&                                               \
+     ((((uintptr_t)(address)) & ((uintptr_t)(length) - (uintptr_t)1)) == (uintptr_t)0))
+
+/* Dynamic lists are numbered behind the predefined ones; predefined list numbers wrap out of range. */
+#define XCP_DAQ_DYNAMIC_LIST_INDEX(daqListNumber)   UINT16(UINT16(daqListNumber) - UINT16(XCP_MIN_DAQ))
+
+/*
+**  The DTO queue is a single-producer/single-consumer ring; without C11 atomics
+**  index accesses are guarded by the DAQ critical section instead.
+*/
+#if XCP_DAQ_ENABLE_LOCK_FREE_DTO_QUEUE == XCP_ON
+#define XCP_DAQ_QUEUE_ENTER_CRITICAL()
+#define XCP_DAQ_QUEUE_LEAVE_CRITICAL()
+#define XCP_DAQ_QUEUE_LOAD_RELAXED(idx)         atomic_load_explicit(&(idx), memory_order_relaxed)
+#define XCP_DAQ_QUEUE_LOAD_ACQUIRE(idx)         atomic_load_explicit(&(idx), memory_order_acquire)
+#define XCP_DAQ_QUEUE_STORE_RELEASE(idx, value) atomic_store_explicit(&(idx), (value), memory_order_release)
+#define XCP_DAQ_QUEUE_STORE_RELAXED(idx, value) atomic_store_explicit(&(idx), (value), memory_order_relaxed)
+#else
+#define XCP_DAQ_QUEUE_ENTER_CRITICAL()          XCP_DAQ_ENTER_CRITICAL()
+#define XCP_DAQ_QUEUE_LEAVE_CRITICAL()          XCP_DAQ_LEAVE_CRITICAL()
+#define XCP_DAQ_QUEUE_LOAD_RELAXED(idx)         (idx)
+#define XCP_DAQ_QUEUE_LOAD_ACQUIRE(idx)         (idx)
+#define XCP_DAQ_QUEUE_STORE_RELEASE(idx, value) ((idx) = (value))
+#define XCP_DAQ_QUEUE_STORE_RELAXED(idx, value) ((idx) = (value))
+#endif /* XCP_DAQ_ENABLE_LOCK_FREE_DTO_QUEUE */
+
+/*
+** Local Constants.
+*/
+#define XCP_DAQ_GATHER_HEADER_PID           UINT8(0x01)
+#define XCP_DAQ_GATHER_HEADER_TIMESTAMP     UINT8(0x02)
+#define XCP_DAQ_GATHER_HEADER_REMOTE        UINT8(0x04)     /* Entries are read from the target process as a whole. */
+
+#define XCP_DAQ_DTO_INDEX(value)            ((XCP_DAQ_DTO_INDEX_TYPE)(value))
+#define XCP_DAQ_DTO_BUFFER_MASK             XCP_DAQ_DTO_INDEX(XCP_DAQ_DTO_BUFFER_SIZE - 1)
+
+#if XCP_DAQ_ENABLE_RESUME == XCP_ON
+/*
+**  Resume image layout (little endian):
+**
+**  header      magic[2], version, layout, session configuration id[2],
+**              number of lists[2], number of ODTs[2], number of ODT entries[2]
+**  lists       flags, mode, prescaler, priority, event channel[2], number of ODTs[2]
+**  ODTs        number of ODT entries[2]
+**  ODT entries address[4], (extension), (bit offset), length
+**  trailer     Fletcher-16 checksum[2] over everything above
+*/
+#define XCP_DAQ_IMAGE_MAGIC_0               UINT8(0x58)     /* 'X' */
+#define XCP_DAQ_IMAGE_MAGIC_1               UINT8(0x44)     /* 'D' */
+#define XCP_DAQ_IMAGE_VERSION               UINT8(1)
+#define XCP_DAQ_IMAGE_LAYOUT_ADDR_EXT       UINT8(0x01)
+#define XCP_DAQ_IMAGE_LAYOUT_BIT_OFFSET     UINT8(0x02)
+#define XCP_DAQ_IMAGE_HEADER_SIZE           UINT32(12)
+#define XCP_DAQ_IMAGE_LIST_SIZE             UINT32(8)
+#define XCP_DAQ_IMAGE_ODT_SIZE              UINT32(2)
+#define XCP_DAQ_IMAGE_TRAILER_SIZE          UINT32(2)
+#define XCP_DAQ_IMAGE_LIST_RESUME           UINT8(0x01)
+#define XCP_DAQ_IMAGE_NO_EVENT              UINT16(0xffff)
+#endif /* XCP_DAQ_ENABLE_RESUME */
+
+#if XCP_ENABLE_STIM == XCP_ON
+#define XCP_DAQ_STIM_SLOT_MASK              UINT8(0x03)
+#define XCP_DAQ_STIM_SLOT_FRESH             UINT8(0x80)
+#endif /* XCP_ENABLE_STIM */
+
+/* Contexts reading gather plans: one per event channel, plus the STIM receiver. */
+#if XCP_ENABLE_STIM == XCP_ON
+#define XCP_DAQ_PLAN_USER_STIM              UINT16(XCP_DAQ_MAX_EVENT_CHANNEL)
+#define XCP_DAQ_PLAN_USERS                  (XCP_DAQ_MAX_EVENT_CHANNEL + 1)
+#else
+#define XCP_DAQ_PLAN_USERS                  XCP_DAQ_MAX_EVENT_CHANNEL
+#endif /* XCP_ENABLE_STIM */
 
 
 /*
@@ -71,11 +287,59 @@ typedef enum tagXcpDaq_ListTransitionType {
 XCP_STATIC XcpDaq_ODTType const * XcpDaq_GetOdt(XcpDaq_ListIntegerType daqListNumber, XcpDaq_ODTIntegerType odtNumber);
 void XcpDaq_PrintDAQDetails(void);
 XCP_STATIC void XcpDaq_StartStopLists(XcpDaq_ListTransitionType transition);
+XCP_STATIC void XcpDaq_UpdateFirstPids(void);
 XCP_STATIC void XcpDaq_InitMessageQueue(void);
+XCP_STATIC bool XcpDaq_PeekQueue(XcpDaq_DtoQueueType * queue, XcpDaq_MessageType * msg);
+XCP_STATIC void XcpDaq_PublishMessage(uint16_t eventChannelNumber, uint8_t priority, uint8_t dlc);
+#if XCP_DAQ_ENABLE_TRANSMIT_TASK == XCP_ON
+XCP_STATIC bool XcpDaq_MessagesPending(void);
+XCP_STATIC bool XcpDaq_ExchangeTransmitterWaiting(bool waiting);
+XCP_STATIC void XcpDaq_NotifyTransmitter(void);
+#endif /* XCP_DAQ_ENABLE_TRANSMIT_TASK */
+XCP_STATIC XcpDaq_GatherPlanType * XcpDaq_EnterPlan(uint16_t user);
+XCP_STATIC void XcpDaq_LeavePlan(uint16_t user);
+XCP_STATIC bool XcpDaq_LockPlans(void);
+XCP_STATIC XcpDaq_GatherPlanType * XcpDaq_AcquireInactivePlan(void);
+XCP_STATIC void XcpDaq_PublishPlan(XcpDaq_GatherPlanType const * plan);
+XCP_STATIC void XcpDaq_ReleasePlan(void);
+XCP_STATIC void XcpDaq_ResetGatherPlan(XcpDaq_GatherPlanType * plan);
+XCP_STATIC bool XcpDaq_PublishGatherPlan(XcpDaq_GatherPlanType * plan);
+XCP_STATIC bool XcpDaq_BuildGatherPlan(XcpDaq_GatherPlanType * plan);
+XCP_STATIC bool XcpDaq_CompileGatherList(XcpDaq_GatherPlanType * plan, XcpDaq_ListIntegerType daqListNumber);
+#if XCP_ENABLE_ADDRESS_MAPPER == XCP_ON
+XCP_STATIC bool XcpDaq_MapAddress(Xcp_MtaType const * source, uint8_t ** address);
+#endif /* XCP_ENABLE_ADDRESS_MAPPER */
+XCP_STATIC void XcpDaq_PutTimestamp(uint8_t * dst, uint32_t timestamp);
+XCP_STATIC XcpDaq_GatherPlanType * XcpDaq_EnterActiveEvent(uint16_t eventChannelNumber);
+XCP_STATIC bool XcpDaq_SampleEvent(XcpDaq_GatherPlanType * plan, uint16_t eventChannelNumber, uint32_t timestamp);
+XCP_STATIC bool XcpDaq_AdvancePrescaler(XcpDaq_ListStateType * state);
+XCP_STATIC void XcpDaq_EventsPublished(void);
+#if XCP_DAQ_OVERLOAD_INDICATION == XCP_DAQ_OVERLOAD_INDICATION_EVENT
+XCP_STATIC void XcpDaq_IndicateOverload(void);
+#endif /* XCP_DAQ_OVERLOAD_INDICATION */
+#if XCP_DAQ_ENABLE_SEQLOCK == XCP_ON
+XCP_STATIC bool XcpDaq_CompileSnapshot(XcpDaq_GatherPlanType * plan, XcpDaq_GatherEventType const * event);
+XCP_STATIC bool XcpDaq_TakeSnapshot(XcpDaq_GatherPlanType * plan, XcpDaq_GatherEventType const * event, bool const * due);
+#endif /* XCP_DAQ_ENABLE_SEQLOCK */
+#if XCP_ENABLE_STIM == XCP_ON
+XCP_STATIC bool XcpDaq_CompileStimBuffer(XcpDaq_GatherPlanType * plan, XcpDaq_GatherListType * gatherList, uint16_t size);
+XCP_STATIC void XcpDaq_ApplyStim(XcpDaq_GatherPlanType const * plan, XcpDaq_GatherListType const * list, uint32_t timestamp);
+XCP_STATIC uint8_t XcpDaq_ExchangeStimSlot(XcpDaq_StimBufferType * stim, uint8_t slot);
+#endif /* XCP_ENABLE_STIM */
 #if XCP_DAQ_ENABLE_DYNAMIC_LISTS == XCP_ON
 XCP_STATIC bool XcpDaq_AllocValidateTransition(XcpDaq_AllocTransitionype transition);
 XCP_STATIC XcpDaq_ListIntegerType XcpDaq_GetDynamicListCount(void);
+XCP_STATIC void * XcpDaq_ArenaBegin(void);
+XCP_STATIC bool XcpDaq_ArenaGrow(uint32_t count, uint32_t size);
 #endif /* XCP_DAQ_ENABLE_DYNAMIC_LISTS */
+#if XCP_DAQ_ENABLE_RESUME == XCP_ON
+XCP_STATIC uint8_t XcpDaq_ImageLayout(void);
+XCP_STATIC uint32_t XcpDaq_ImageLength(uint16_t listCount, uint16_t odtCount, uint16_t entryCount);
+XCP_STATIC uint16_t XcpDaq_ImageChecksum(uint8_t const * image, uint32_t length);
+XCP_STATIC void XcpDaq_PutImageWord(uint8_t * dst, uint16_t value);
+XCP_STATIC uint16_t XcpDaq_GetImageWord(uint8_t const * src);
+XCP_STATIC uint16_t XcpDaq_GetEventChannel(XcpDaq_ListIntegerType daqListNumber);
+#endif /* XCP_DAQ_ENABLE_RESUME */
 
 /*
 ** Local Constants.
@@ -95,25 +359,84 @@ XCP_STATIC const uint8_t XcpDaq_AllocTransitionTable[5][4] = {
 ** Local Variables.
 */
 
-XCP_STATIC uint8_t XcpDaq_DtoBuffer[XCP_DAQ_DTO_BUFFER_SIZE + 1];
-XCP_STATIC XcpDaq_DtoBufferStateType XcpDaq_DtoBufferState;
+/*
+**  One DTO queue per priority class and event channel, so events triggered from different
+**  contexts don't contend.
+*/
+XCP_STATIC XcpDaq_DtoQueueType XcpDaq_DtoQueues[XCP_DAQ_PRIORITY_CLASSES][XCP_DAQ_MAX_EVENT_CHANNEL];
+
+/*
+**  Transmit scheduling: priority classes are drained strictly from highest to lowest.
+**  Within a class, event channels are sorted by descending priority; channels of equal
+**  priority form a group that is served round-robin.
+*/
+XCP_STATIC uint16_t XcpDaq_DtoQueueOrder[XCP_DAQ_MAX_EVENT_CHANNEL];
+XCP_STATIC uint16_t XcpDaq_DtoQueueGroupEnd[XCP_DAQ_MAX_EVENT_CHANNEL];
+XCP_STATIC uint16_t XcpDaq_DtoQueueGroupNext[XCP_DAQ_PRIORITY_CLASSES][XCP_DAQ_MAX_EVENT_CHANNEL];
+XCP_STATIC XcpDaq_DtoQueueType * XcpDaq_DtoQueuePeeked = XCP_NULL;
+
+/* Cleared whenever the number of ODTs of a list changes, s. XcpDaq_GetFirstPid(). */
+XCP_STATIC bool XcpDaq_FirstPidsValid = (bool)XCP_FALSE;
+
+#if XCP_DAQ_OVERLOAD_INDICATION == XCP_DAQ_OVERLOAD_INDICATION_EVENT
+XCP_STATIC uint32_t XcpDaq_OverrunsIndicated = UINT32(0);
+/* Room for the transport layer header in front, like the DTO queues; the CTO buffer belongs to the command processor. */
+XCP_STATIC uint8_t XcpDaq_OverloadEvent[XCP_TRANSPORT_LAYER_BUFFER_OFFSET + 2];
+#endif /* XCP_DAQ_OVERLOAD_INDICATION */
+
+#if XCP_DAQ_ENABLE_TRANSMIT_TASK == XCP_ON
+/*
+**  Set by the transmit task right before it blocks. The first producer publishing a DTO
+**  afterwards clears it and wakes the task up, as long as the task is busy draining
+**  the queues producers never enter the kernel.
+*/
+#if XCP_DAQ_ENABLE_LOCK_FREE_DTO_QUEUE == XCP_ON
+XCP_STATIC atomic_bool XcpDaq_TransmitterWaiting;
+#else
+XCP_STATIC bool XcpDaq_TransmitterWaiting = (bool)XCP_FALSE;
+#endif /* XCP_DAQ_ENABLE_LOCK_FREE_DTO_QUEUE */
+#endif /* XCP_DAQ_ENABLE_TRANSMIT_TASK */
 
 #if XCP_DAQ_ENABLE_DYNAMIC_LISTS == XCP_ON
 XCP_STATIC XcpDaq_AllocStateType XcpDaq_AllocState;
-XCP_STATIC XcpDaq_EntityType XcpDaq_Entities[XCP_DAQ_MAX_DYNAMIC_ENTITIES];
-XCP_STATIC XCP_DAQ_ENTITY_TYPE XcpDaq_EntityCount = (XCP_DAQ_ENTITY_TYPE)0;
-XCP_STATIC XCP_DAQ_ENTITY_TYPE XcpDaq_ListCount = (XCP_DAQ_ENTITY_TYPE)0;
-XCP_STATIC XCP_DAQ_ENTITY_TYPE XcpDaq_OdtCount = (XCP_DAQ_ENTITY_TYPE)0;
+/*
+**  Dynamic DAQ arena: ALLOC_DAQ, ALLOC_ODT, and ALLOC_ODT_ENTRY are strictly ordered, so
+**  lists, ODTs, and ODT entries are carved as three dense arrays one after another;
+**  each array starts 4-byte aligned behind its predecessor.
+*/
+XCP_STATIC uint32_t XcpDaq_Arena[(XCP_DAQ_DYNAMIC_MEMORY_SIZE + 3) / 4];
+XCP_STATIC uint32_t XcpDaq_ArenaBase = UINT32(0);     /* Offset of the array currently allocated. */
+XCP_STATIC uint32_t XcpDaq_ArenaUsed = UINT32(0);
+XCP_STATIC XcpDaq_DynamicListType * XcpDaq_DynamicLists = XCP_NULL;
+XCP_STATIC XcpDaq_ODTType * XcpDaq_DynamicOdts = XCP_NULL;
+XCP_STATIC XcpDaq_ODTEntryType * XcpDaq_DynamicOdtEntries = XCP_NULL;
+XCP_STATIC uint16_t XcpDaq_ListCount = UINT16(0);
+XCP_STATIC uint16_t XcpDaq_OdtCount = UINT16(0);
+XCP_STATIC uint16_t XcpDaq_OdtEntryCount = UINT16(0);
 
-XCP_STATIC XcpDaq_ListStateType XcpDaq_ListState ;
 XCP_STATIC XcpDaq_ListConfigurationType XcpDaq_ListConfiguration;
 #endif /* XCP_DAQ_ENABLE_DYNAMIC_LISTS */
 
-#if XCP_DAQ_ENABLE_MULTIPLE_DAQ_LISTS_PER_EVENT  == XCP_OFF
-XCP_STATIC uint8_t XcpDaq_ListForEvent[XCP_DAQ_MAX_EVENT_CHANNEL];
-#else
-    #error XCP_DAQ_ENABLE_MULTIPLE_DAQ_LISTS_PER_EVENT option currently not supported
-#endif /* XCP_DAQ_ENABLE_MULTIPLE_DAQ_LISTS_PER_EVENT */
+/* DAQ lists assigned to an event channel, kept in ascending list-number order. */
+XCP_STATIC XcpDaq_ListIntegerType XcpDaq_ListsForEvent[XCP_DAQ_MAX_EVENT_CHANNEL][XCP_DAQ_MAX_LISTS_PER_EVENT];
+XCP_STATIC uint8_t XcpDaq_ListCountForEvent[XCP_DAQ_MAX_EVENT_CHANNEL];
+
+XCP_STATIC XcpDaq_GatherPlanType XcpDaq_GatherPlans[2];
+XCP_STATIC XcpDaq_PlanIndexType XcpDaq_ActivePlan = UINT8(0);
+/* Plan index + 1 a producer currently samples, zero if none. */
+XCP_STATIC XcpDaq_PlanIndexType XcpDaq_PlanUsers[XCP_DAQ_PLAN_USERS];
+/* Non-zero while a writer owns the inactive plan. */
+XCP_STATIC XcpDaq_PlanIndexType XcpDaq_PlanWriter = UINT8(0);
+#if XCP_DAQ_REMOTE_SAMPLING == XCP_ON
+/* Written by the producer of the event channel only. */
+XCP_STATIC XcpDaq_DropCountType XcpDaq_RemoteReadErrors[XCP_DAQ_MAX_EVENT_CHANNEL];
+#endif /* XCP_DAQ_REMOTE_SAMPLING */
+
+#if XCP_DAQ_ENABLE_SEQLOCK == XCP_ON
+XCP_STATIC XcpDaq_SeqLockType * XcpDaq_EventSeqLocks[XCP_DAQ_MAX_EVENT_CHANNEL];
+/* Written by the producer of the event channel only. */
+XCP_STATIC XcpDaq_DropCountType XcpDaq_SeqLockSkips[XCP_DAQ_MAX_EVENT_CHANNEL];
+#endif /* XCP_DAQ_ENABLE_SEQLOCK */
 
 /*
 **
@@ -127,18 +450,44 @@ XCP_STATIC uint8_t XcpDaq_ListForEvent[XCP_DAQ_MAX_EVENT_CHANNEL];
 #if XCP_DAQ_ENABLE_DYNAMIC_LISTS == XCP_ON
 Xcp_ReturnType XcpDaq_Free(void)
 {
+    XcpDaq_GatherPlanType * plan = XCP_NULL;
     Xcp_ReturnType result = ERR_SUCCESS;
+    uint16_t eventIdx = UINT16(0);
+    uint8_t count = UINT8(0);
 
-    XcpDaq_EntityCount = (XCP_DAQ_ENTITY_TYPE)0;
-    XcpDaq_ListCount = (XCP_DAQ_ENTITY_TYPE)0;
-    XcpDaq_OdtCount = (XCP_DAQ_ENTITY_TYPE)0;
-
-#if XCP_DAQ_ENABLE_MULTIPLE_DAQ_LISTS_PER_EVENT  == XCP_OFF
-    XcpUtl_MemSet(XcpDaq_ListForEvent, UINT8(0), UINT32(sizeof(XcpDaq_ListForEvent[0]) * UINT8(XCP_DAQ_MAX_EVENT_CHANNEL)));
-#endif /* XCP_DAQ_ENABLE_MULTIPLE_DAQ_LISTS_PER_EVENT */
+    plan = XcpDaq_AcquireInactivePlan();
+    if (plan == XCP_NULL) {
+        return ERR_CMD_BUSY;
+    }
+    XcpDaq_ArenaBase = UINT32(0);
+    XcpDaq_ArenaUsed = UINT32(0);
+    XcpDaq_DynamicLists = XCP_NULL;
+    XcpDaq_DynamicOdts = XCP_NULL;
+    XcpDaq_DynamicOdtEntries = XCP_NULL;
+    XcpDaq_ListCount = UINT16(0);
+    XcpDaq_OdtCount = UINT16(0);
+    XcpDaq_OdtEntryCount = UINT16(0);
+    XcpDaq_FirstPidsValid = (bool)XCP_FALSE;
+
+    /* Predefined lists are numbered first, so they are the head of each (ascending) event channel assignment. */
+    for (eventIdx = UINT16(0); eventIdx < UINT16(XCP_DAQ_MAX_EVENT_CHANNEL); ++eventIdx) {
+        for (count = UINT8(0); count < XcpDaq_ListCountForEvent[eventIdx]; ++count) {
+            if (XcpDaq_ListsForEvent[eventIdx][count] >= XCP_MIN_DAQ) {
+                break;
+            }
+        }
+        XcpDaq_ListCountForEvent[eventIdx] = count;
+    }
+    /* Running predefined lists keep running. */
+    (void)XcpDaq_PublishGatherPlan(plan);
+    /* The previous plan refers to list states within the arena; the master repeats FREE_DAQ if it's still sampled. */
+    if (XcpDaq_AcquireInactivePlan() == XCP_NULL) {
+        return ERR_CMD_BUSY;
+    }
+    XcpDaq_ReleasePlan();
 
     if (XcpDaq_AllocValidateTransition(XCP_CALL_FREE_DAQ)) {
-        XcpUtl_MemSet(XcpDaq_Entities, UINT8(0), UINT32(sizeof(XcpDaq_EntityType) * (XCP_DAQ_ENTITY_TYPE)XCP_DAQ_MAX_DYNAMIC_ENTITIES));
+        XcpUtl_MemSet(XcpDaq_Arena, UINT8(0), UINT32(sizeof(XcpDaq_Arena)));
         XcpDaq_AllocState = XCP_AFTER_FREE_DAQ;
     } else {
         result = ERR_SEQUENCE;  /* Never touched; function always succeeds. */
@@ -148,7 +497,7 @@ Xcp_ReturnType XcpDaq_Free(void)
 
 Xcp_ReturnType XcpDaq_Alloc(XcpDaq_ListIntegerType daqCount)
 {
-    XCP_DAQ_ENTITY_TYPE idx;
+    uint16_t idx;
     Xcp_ReturnType result = ERR_SUCCESS;
 
     if (!XcpDaq_AllocValidateTransition(XCP_CALL_ALLOC_DAQ)) {
@@ -157,14 +506,24 @@ Xcp_ReturnType XcpDaq_Alloc(XcpDaq_ListIntegerType daqCount)
 #endif /* XCP_DAQ_ENABLE_RESET_DYN_DAQ_CONFIG_ON_SEQUENCE_ERROR */
         result = ERR_SEQUENCE;
     } else {
-        if ((XcpDaq_EntityCount + daqCount) <= (XCP_DAQ_ENTITY_TYPE)XCP_DAQ_MAX_DYNAMIC_ENTITIES) {
+        if (XcpDaq_DynamicLists == XCP_NULL) {
+            XcpDaq_DynamicLists = (XcpDaq_DynamicListType *)XcpDaq_ArenaBegin();
+        }
+        if (XcpDaq_ArenaGrow(UINT32(XcpDaq_ListCount) + UINT32(daqCount), UINT32(sizeof(XcpDaq_DynamicListType)))) {
             XcpDaq_AllocState = XCP_AFTER_ALLOC_DAQ;
-            for (idx = XcpDaq_EntityCount; idx < (XcpDaq_EntityCount + daqCount); ++idx) {
-                XcpDaq_Entities[idx].kind = UINT8(XCP_ENTITY_DAQ_LIST);
-                XcpDaq_Entities[idx].entity.daqList.numOdts = (XcpDaq_ODTIntegerType)0;
+            for (idx = XcpDaq_ListCount; idx < UINT16(XcpDaq_ListCount + daqCount); ++idx) {
+                XcpDaq_DynamicLists[idx].numOdts = (XcpDaq_ODTIntegerType)0;
+                XcpDaq_DynamicLists[idx].firstOdt = UINT16(0);
+                XcpDaq_DynamicLists[idx].state.mode = UINT8(0);
+#if XCP_DAQ_ENABLE_PRESCALER == XCP_ON
+                XcpDaq_DynamicLists[idx].state.prescaler = UINT8(1);
+                XcpDaq_DynamicLists[idx].state.counter = UINT8(0);
+#endif /* XCP_DAQ_ENABLE_PRESCALER */
+                XCP_DAQ_QUEUE_STORE_RELAXED(XcpDaq_DynamicLists[idx].state.overload, UINT8(0));
+                XCP_DAQ_QUEUE_STORE_RELAXED(XcpDaq_DynamicLists[idx].state.overruns, UINT32(0));
             }
-            XcpDaq_ListCount += (XCP_DAQ_ENTITY_TYPE)daqCount;
-            XcpDaq_EntityCount += (XCP_DAQ_ENTITY_TYPE)daqCount;
+            XcpDaq_ListCount += UINT16(daqCount);
+            XcpDaq_FirstPidsValid = (bool)XCP_FALSE;
         } else {
             result = ERR_MEMORY_OVERFLOW;
         }
@@ -174,7 +533,7 @@ Xcp_ReturnType XcpDaq_Alloc(XcpDaq_ListIntegerType daqCount)
 
 Xcp_ReturnType XcpDaq_AllocOdt(XcpDaq_ListIntegerType daqListNumber, XcpDaq_ODTIntegerType odtCount)
 {
-    XCP_DAQ_ENTITY_TYPE idx;
+    XcpDaq_DynamicListType * dl = XCP_NULL;
     Xcp_ReturnType result = ERR_SUCCESS;
 
     if (!XcpDaq_AllocValidateTransition(XCP_CALL_ALLOC_ODT)) {
@@ -182,16 +541,19 @@ Xcp_ReturnType XcpDaq_AllocOdt(XcpDaq_ListIntegerType daqListNumber, XcpDaq_ODTI
         XcpDaq_Init();
 #endif /* XCP_DAQ_ENABLE_RESET_DYN_DAQ_CONFIG_ON_SEQUENCE_ERROR */
         result = ERR_SEQUENCE;
+    } else if (XCP_DAQ_DYNAMIC_LIST_INDEX(daqListNumber) >= XcpDaq_ListCount) {
+        result = ERR_OUT_OF_RANGE;     /* Predefined lists included. */
     } else {
-        if ((XcpDaq_EntityCount + odtCount) <= (XCP_DAQ_ENTITY_TYPE)XCP_DAQ_MAX_DYNAMIC_ENTITIES) {
+        if (XcpDaq_DynamicOdts == XCP_NULL) {
+            XcpDaq_DynamicOdts = (XcpDaq_ODTType *)XcpDaq_ArenaBegin();
+        }
+        if (XcpDaq_ArenaGrow(UINT32(XcpDaq_OdtCount) + UINT32(odtCount), UINT32(sizeof(XcpDaq_ODTType)))) {
             XcpDaq_AllocState = XCP_AFTER_ALLOC_ODT;
-            for (idx = XcpDaq_EntityCount; idx < (XcpDaq_EntityCount + odtCount); ++idx) {
-                XcpDaq_Entities[idx].kind = UINT8(XCP_ENTITY_ODT);
-            }
-            XcpDaq_Entities[daqListNumber].entity.daqList.numOdts += odtCount;
-            XcpDaq_Entities[daqListNumber].entity.daqList.firstOdt = XcpDaq_EntityCount;
-            XcpDaq_OdtCount += (XCP_DAQ_ENTITY_TYPE)odtCount;
-            XcpDaq_EntityCount += (XCP_DAQ_ENTITY_TYPE)odtCount;
+            dl = &XcpDaq_DynamicLists[XCP_DAQ_DYNAMIC_LIST_INDEX(daqListNumber)];
+            dl->numOdts += odtCount;
+            dl->firstOdt = XcpDaq_OdtCount;
+            XcpDaq_OdtCount += UINT16(odtCount);
+            XcpDaq_FirstPidsValid = (bool)XCP_FALSE;
         } else {
             result = ERR_MEMORY_OVERFLOW;
         }
@@ -202,8 +564,7 @@ Xcp_ReturnType XcpDaq_AllocOdt(XcpDaq_ListIntegerType daqListNumber, XcpDaq_ODTI
 
 Xcp_ReturnType XcpDaq_AllocOdtEntry(XcpDaq_ListIntegerType daqListNumber, XcpDaq_ODTIntegerType odtNumber, XcpDaq_ODTEntryIntegerType odtEntriesCount)
 {
-    XCP_DAQ_ENTITY_TYPE idx;
-    XcpDaq_ODTIntegerType odt;
+    XcpDaq_ODTType * odt = XCP_NULL;
     Xcp_ReturnType result = ERR_SUCCESS;
 
     if (!XcpDaq_AllocValidateTransition(XCP_CALL_ALLOC_ODT_ENTRY)) {
@@ -211,16 +572,19 @@ Xcp_ReturnType XcpDaq_AllocOdtEntry(XcpDaq_ListIntegerType daqListNumber, XcpDaq
         XcpDaq_Init();
 #endif /* XCP_DAQ_ENABLE_RESET_DYN_DAQ_CONFIG_ON_SEQUENCE_ERROR */
         result = ERR_SEQUENCE;
+    } else if ((XCP_DAQ_DYNAMIC_LIST_INDEX(daqListNumber) >= XcpDaq_ListCount) ||
+               (odtNumber >= XcpDaq_DynamicLists[XCP_DAQ_DYNAMIC_LIST_INDEX(daqListNumber)].numOdts)) {
+        result = ERR_OUT_OF_RANGE;
     } else {
-        if ((XcpDaq_EntityCount + odtEntriesCount) <= (XCP_DAQ_ENTITY_TYPE)XCP_DAQ_MAX_DYNAMIC_ENTITIES) {
+        if (XcpDaq_DynamicOdtEntries == XCP_NULL) {
+            XcpDaq_DynamicOdtEntries = (XcpDaq_ODTEntryType *)XcpDaq_ArenaBegin();
+        }
+        if (XcpDaq_ArenaGrow(UINT32(XcpDaq_OdtEntryCount) + UINT32(odtEntriesCount), UINT32(sizeof(XcpDaq_ODTEntryType)))) {
             XcpDaq_AllocState = XCP_AFTER_ALLOC_ODT_ENTRY;
-            for (idx = XcpDaq_EntityCount; idx < (XcpDaq_EntityCount + odtEntriesCount); ++idx) {
-                XcpDaq_Entities[idx].kind = UINT8(XCP_ENTITY_ODT_ENTRY);
-            }
-            odt = (XcpDaq_ODTIntegerType)(XcpDaq_Entities[daqListNumber].entity.daqList.firstOdt + UINT16(odtNumber));
-            XcpDaq_Entities[odt].entity.odt.firstOdtEntry = XcpDaq_EntityCount;
-            XcpDaq_Entities[odt].entity.odt.numOdtEntries = odtEntriesCount;
-            XcpDaq_EntityCount += (XCP_DAQ_ENTITY_TYPE)odtEntriesCount;
+            odt = &XcpDaq_DynamicOdts[XcpDaq_DynamicLists[XCP_DAQ_DYNAMIC_LIST_INDEX(daqListNumber)].firstOdt + UINT16(odtNumber)];
+            odt->firstOdtEntry = XcpDaq_OdtEntryCount;
+            odt->numOdtEntries = odtEntriesCount;
+            XcpDaq_OdtEntryCount += UINT16(odtEntriesCount);
         } else {
             result = ERR_MEMORY_OVERFLOW;
         }
@@ -229,6 +593,31 @@ Xcp_ReturnType XcpDaq_AllocOdtEntry(XcpDaq_ListIntegerType daqListNumber, XcpDaq
 }
 
 
+/** @brief Start the array of the current allocation phase at the next aligned arena offset. */
+XCP_STATIC void * XcpDaq_ArenaBegin(void)
+{
+    XcpDaq_ArenaBase = (XcpDaq_ArenaUsed + UINT32(3)) & ~UINT32(3);
+    XcpDaq_ArenaUsed = XcpDaq_ArenaBase;
+    return (void *)((uint8_t *)XcpDaq_Arena + XcpDaq_ArenaBase);
+}
+
+
+/** @brief Resize the array of the current allocation phase to `count` elements of `size` bytes.
+ *
+ *  @return XCP_FALSE if the arena is exhausted; nothing is changed in this case.
+ */
+XCP_STATIC bool XcpDaq_ArenaGrow(uint32_t count, uint32_t size)
+{
+    uint32_t used = XcpDaq_ArenaBase + (count * size);
+
+    if (used > UINT32(XCP_DAQ_DYNAMIC_MEMORY_SIZE)) {
+        return (bool)XCP_FALSE;
+    }
+    XcpDaq_ArenaUsed = used;
+    return (bool)XCP_TRUE;
+}
+
+
 XCP_STATIC bool XcpDaq_AllocValidateTransition(XcpDaq_AllocTransitionype transition)
 {
     /* printf("STATE: %u TRANSITION: %u\n", XcpDaq_AllocState, transition); */
@@ -246,12 +635,292 @@ XCP_STATIC XcpDaq_ListIntegerType XcpDaq_GetDynamicListCount(void)
 }
 #endif /* XCP_DAQ_ENABLE_DYNAMIC_LISTS */
 
+#if XCP_DAQ_ENABLE_RESUME == XCP_ON
+/** @brief Serialise the dynamic DAQ configuration into a resume image.
+ *
+ *  With `resume` set, lists currently selected or started are flagged to be started
+ *  by @ref XcpDaq_RestoreConfiguration; their SELECTED flag is reset as for START_STOP_SYNCH.
+ *
+ *  @param image    Destination buffer.
+ *  @param size     Size of `image`.
+ *  @param resume   Flag lists for automatic start.
+ *  @param sessionConfigurationId   Stored along with the lists and reported by GET_STATUS.
+ *  @return Length of the image, 0 if the configuration doesn't fit into `size`.
+ */
+uint32_t XcpDaq_StoreConfiguration(uint8_t * image, uint32_t size, bool resume, uint16_t sessionConfigurationId)
+{
+    XcpDaq_DynamicListType * daqList = XCP_NULL;
+    XcpDaq_ODTEntryType const * entry = XCP_NULL;
+    uint8_t * record = image;
+    uint32_t length = UINT32(0);
+    XcpDaq_ListIntegerType daqListNumber = (XcpDaq_ListIntegerType)0;
+    XcpDaq_ODTIntegerType odtNumber = (XcpDaq_ODTIntegerType)0;
+    XcpDaq_ODTEntryIntegerType odtEntryNumber = (XcpDaq_ODTEntryIntegerType)0;
+    uint16_t entryCount = UINT16(0);
+
+    entryCount = XcpDaq_OdtEntryCount;
+    length = XcpDaq_ImageLength(XcpDaq_ListCount, XcpDaq_OdtCount, entryCount);
+    if (length > size) {
+        return UINT32(0);
+    }
+
+    record[0] = XCP_DAQ_IMAGE_MAGIC_0;
+    record[1] = XCP_DAQ_IMAGE_MAGIC_1;
+    record[2] = XCP_DAQ_IMAGE_VERSION;
+    record[3] = XcpDaq_ImageLayout();
+    XcpDaq_PutImageWord(&record[4], sessionConfigurationId);
+    XcpDaq_PutImageWord(&record[6], XcpDaq_ListCount);
+    XcpDaq_PutImageWord(&record[8], XcpDaq_OdtCount);
+    XcpDaq_PutImageWord(&record[10], entryCount);
+    record += XCP_DAQ_IMAGE_HEADER_SIZE;
+
+    for (daqListNumber = XCP_MIN_DAQ; daqListNumber < (XcpDaq_ListIntegerType)(XCP_MIN_DAQ + XcpDaq_ListCount); ++daqListNumber) {
+        daqList = &XcpDaq_DynamicLists[XCP_DAQ_DYNAMIC_LIST_INDEX(daqListNumber)];
+        record[0] = UINT8(0);
+        if (resume && ((daqList->state.mode & (XCP_DAQ_LIST_MODE_SELECTED | XCP_DAQ_LIST_MODE_STARTED)) != UINT8(0))) {
+            record[0] = XCP_DAQ_IMAGE_LIST_RESUME;
+            daqList->state.mode &= UINT8(~XCP_DAQ_LIST_MODE_SELECTED);
+        }
+        record[1] = daqList->state.mode & UINT8(~(XCP_DAQ_LIST_MODE_SELECTED | XCP_DAQ_LIST_MODE_STARTED));
+#if XCP_DAQ_ENABLE_PRESCALER == XCP_ON
+        record[2] = daqList->state.prescaler;
+#else
+        record[2] = UINT8(1);
+#endif /* XCP_DAQ_ENABLE_PRESCALER */
+#if XCP_DAQ_ENABLE_PRIORITIZATION == XCP_ON
+        record[3] = daqList->state.priority;
+#else
+        record[3] = UINT8(0);
+#endif /* XCP_DAQ_ENABLE_PRIORITIZATION */
+        XcpDaq_PutImageWord(&record[4], XcpDaq_GetEventChannel(daqListNumber));
+        XcpDaq_PutImageWord(&record[6], UINT16(daqList->numOdts));
+        record += XCP_DAQ_IMAGE_LIST_SIZE;
+    }
+    for (daqListNumber = XCP_MIN_DAQ; daqListNumber < (XcpDaq_ListIntegerType)(XCP_MIN_DAQ + XcpDaq_ListCount); ++daqListNumber) {
+        for (odtNumber = (XcpDaq_ODTIntegerType)0; odtNumber < XcpDaq_GetListConfiguration(daqListNumber)->numOdts; ++odtNumber) {
+            XcpDaq_PutImageWord(record, UINT16(XcpDaq_GetOdt(daqListNumber, odtNumber)->numOdtEntries));
+            record += XCP_DAQ_IMAGE_ODT_SIZE;
+        }
+    }
+    for (daqListNumber = XCP_MIN_DAQ; daqListNumber < (XcpDaq_ListIntegerType)(XCP_MIN_DAQ + XcpDaq_ListCount); ++daqListNumber) {
+        for (odtNumber = (XcpDaq_ODTIntegerType)0; odtNumber < XcpDaq_GetListConfiguration(daqListNumber)->numOdts; ++odtNumber) {
+            for (odtEntryNumber = (XcpDaq_ODTEntryIntegerType)0; odtEntryNumber < XcpDaq_GetOdt(daqListNumber, odtNumber)->numOdtEntries; ++odtEntryNumber) {
+                entry = XcpDaq_GetOdtEntry(daqListNumber, odtNumber, odtEntryNumber);
+                XcpDaq_PutImageWord(&record[0], UINT16(entry->mta.address & UINT32(0xffff)));
+                XcpDaq_PutImageWord(&record[2], UINT16(entry->mta.address >> 16));
+                record += 4;
+#if XCP_DAQ_ENABLE_ADDR_EXT == XCP_ON
+                *record++ = entry->mta.ext;
+#endif /* XCP_DAQ_ENABLE_ADDR_EXT */
+#if XCP_DAQ_ENABLE_BIT_OFFSET == XCP_ON
+                *record++ = entry->bitOffset;
+#endif /* XCP_DAQ_ENABLE_BIT_OFFSET */
+                *record++ = UINT8(entry->length);
+            }
+        }
+    }
+    XcpDaq_PutImageWord(record, XcpDaq_ImageChecksum(image, length - XCP_DAQ_IMAGE_TRAILER_SIZE));
+    return length;
+}
+
+
+/** @brief Rebuild the dynamic DAQ configuration from a resume image.
+ *
+ *  Lists flagged for resume are started and the DAQ processor is set to running, so
+ *  acquisition continues without a master.
+ *
+ *  @param image    Image created by @ref XcpDaq_StoreConfiguration.
+ *  @param size     Number of valid bytes at `image` (may exceed the image length).
+ *  @param sessionConfigurationId   Receives the stored session configuration id.
+ *  @return XCP_FALSE if the image is corrupt, doesn't match the configuration of this slave,
+ *          or can't be restored; the DAQ configuration is empty in this case.
+ */
+bool XcpDaq_RestoreConfiguration(uint8_t const * image, uint32_t size, uint16_t * sessionConfigurationId)
+{
+    uint8_t const * record = image;
+    XcpDaq_ListStateType * state = XCP_NULL;
+    XcpDaq_ODTEntryType * entry = XCP_NULL;
+    uint32_t length = UINT32(0);
+    uint16_t listCount = UINT16(0);
+    uint16_t odtsLeft = UINT16(0);
+    uint16_t entriesLeft = UINT16(0);
+    uint16_t count = UINT16(0);
+    uint16_t eventChannelNumber = UINT16(0);
+    XcpDaq_ListIntegerType daqListNumber = (XcpDaq_ListIntegerType)0;
+    XcpDaq_ODTIntegerType odtNumber = (XcpDaq_ODTIntegerType)0;
+    XcpDaq_ODTEntryIntegerType odtEntryNumber = (XcpDaq_ODTEntryIntegerType)0;
+    bool resume = (bool)XCP_FALSE;
+    bool result = (bool)XCP_TRUE;
+
+    if ((size < (XCP_DAQ_IMAGE_HEADER_SIZE + XCP_DAQ_IMAGE_TRAILER_SIZE)) ||
+        (record[0] != XCP_DAQ_IMAGE_MAGIC_0) || (record[1] != XCP_DAQ_IMAGE_MAGIC_1) ||
+        (record[2] != XCP_DAQ_IMAGE_VERSION) || (record[3] != XcpDaq_ImageLayout())) {
+        return (bool)XCP_FALSE;
+    }
+    listCount = XcpDaq_GetImageWord(&record[6]);
+    odtsLeft = XcpDaq_GetImageWord(&record[8]);
+    entriesLeft = XcpDaq_GetImageWord(&record[10]);
+    length = XcpDaq_ImageLength(listCount, odtsLeft, entriesLeft);
+    if ((length > size) ||
+        (XcpDaq_GetImageWord(&image[length - XCP_DAQ_IMAGE_TRAILER_SIZE]) != XcpDaq_ImageChecksum(image, length - XCP_DAQ_IMAGE_TRAILER_SIZE))) {
+        return (bool)XCP_FALSE;
+    }
+    *sessionConfigurationId = XcpDaq_GetImageWord(&record[4]);
+    record += XCP_DAQ_IMAGE_HEADER_SIZE;
+
+    (void)XcpDaq_Free();
+    result = (XcpDaq_Alloc((XcpDaq_ListIntegerType)listCount) == ERR_SUCCESS);
+    for (daqListNumber = XCP_MIN_DAQ; result && (daqListNumber < (XcpDaq_ListIntegerType)(XCP_MIN_DAQ + listCount)); ++daqListNumber) {
+        state = XcpDaq_GetListState(daqListNumber);
+        state->mode = record[1] & UINT8(~(XCP_DAQ_LIST_MODE_SELECTED | XCP_DAQ_LIST_MODE_STARTED));
+        if ((record[0] & XCP_DAQ_IMAGE_LIST_RESUME) == XCP_DAQ_IMAGE_LIST_RESUME) {
+            state->mode |= XCP_DAQ_LIST_MODE_SELECTED;
+            resume = (bool)XCP_TRUE;
+        }
+#if XCP_DAQ_ENABLE_PRESCALER == XCP_ON
+        state->prescaler = (record[2] == UINT8(0)) ? UINT8(1) : record[2];
+#endif /* XCP_DAQ_ENABLE_PRESCALER */
+#if XCP_DAQ_ENABLE_PRIORITIZATION == XCP_ON
+        state->priority = record[3];
+#endif /* XCP_DAQ_ENABLE_PRIORITIZATION */
+        eventChannelNumber = XcpDaq_GetImageWord(&record[4]);
+        if (eventChannelNumber != XCP_DAQ_IMAGE_NO_EVENT) {
+            result = XcpDaq_AddEventChannel(daqListNumber, eventChannelNumber);
+        }
+        count = XcpDaq_GetImageWord(&record[6]);
+        if (count > odtsLeft) {
+            result = (bool)XCP_FALSE;
+        } else if (result && (count > UINT16(0))) {
+            odtsLeft -= count;
+            result = (XcpDaq_AllocOdt(daqListNumber, (XcpDaq_ODTIntegerType)count) == ERR_SUCCESS);
+        }
+        record += XCP_DAQ_IMAGE_LIST_SIZE;
+    }
+    result = result && (odtsLeft == UINT16(0));
+    for (daqListNumber = XCP_MIN_DAQ; result && (daqListNumber < (XcpDaq_ListIntegerType)(XCP_MIN_DAQ + listCount)); ++daqListNumber) {
+        for (odtNumber = (XcpDaq_ODTIntegerType)0; result && (odtNumber < XcpDaq_GetListConfiguration(daqListNumber)->numOdts); ++odtNumber) {
+            count = XcpDaq_GetImageWord(record);
+            if (count > entriesLeft) {
+                result = (bool)XCP_FALSE;
+            } else {
+                entriesLeft -= count;
+                result = (XcpDaq_AllocOdtEntry(daqListNumber, odtNumber, (XcpDaq_ODTEntryIntegerType)count) == ERR_SUCCESS);
+            }
+            record += XCP_DAQ_IMAGE_ODT_SIZE;
+        }
+    }
+    result = result && (entriesLeft == UINT16(0));
+    for (daqListNumber = XCP_MIN_DAQ; result && (daqListNumber < (XcpDaq_ListIntegerType)(XCP_MIN_DAQ + listCount)); ++daqListNumber) {
+        for (odtNumber = (XcpDaq_ODTIntegerType)0; odtNumber < XcpDaq_GetListConfiguration(daqListNumber)->numOdts; ++odtNumber) {
+            for (odtEntryNumber = (XcpDaq_ODTEntryIntegerType)0; odtEntryNumber < XcpDaq_GetOdt(daqListNumber, odtNumber)->numOdtEntries; ++odtEntryNumber) {
+                entry = XcpDaq_GetOdtEntry(daqListNumber, odtNumber, odtEntryNumber);
+                entry->mta.address = XCP_MAKEDWORD(XcpDaq_GetImageWord(&record[2]), XcpDaq_GetImageWord(&record[0]));
+                record += 4;
+#if XCP_DAQ_ENABLE_ADDR_EXT == XCP_ON
+                entry->mta.ext = *record++;
+#endif /* XCP_DAQ_ENABLE_ADDR_EXT */
+#if XCP_DAQ_ENABLE_BIT_OFFSET == XCP_ON
+                entry->bitOffset = *record++;
+#endif /* XCP_DAQ_ENABLE_BIT_OFFSET */
+                entry->length = UINT32(*record++);
+            }
+        }
+    }
+    if (result && resume) {
+        result = (XcpDaq_StartSelectedLists() == ERR_SUCCESS);
+        if (result) {
+            XcpDaq_SetProcessorState(XCP_DAQ_STATE_RUNNING);
+        }
+    }
+    if (!result) {
+        (void)XcpDaq_Free();
+    }
+    return result;
+}
+
+
+XCP_STATIC uint8_t XcpDaq_ImageLayout(void)
+{
+    uint8_t layout = UINT8(0);
+
+#if XCP_DAQ_ENABLE_ADDR_EXT == XCP_ON
+    layout |= XCP_DAQ_IMAGE_LAYOUT_ADDR_EXT;
+#endif /* XCP_DAQ_ENABLE_ADDR_EXT */
+#if XCP_DAQ_ENABLE_BIT_OFFSET == XCP_ON
+    layout |= XCP_DAQ_IMAGE_LAYOUT_BIT_OFFSET;
+#endif /* XCP_DAQ_ENABLE_BIT_OFFSET */
+    return layout;
+}
+
+
+XCP_STATIC uint32_t XcpDaq_ImageLength(uint16_t listCount, uint16_t odtCount, uint16_t entryCount)
+{
+    uint32_t entrySize = UINT32(5);
+
+#if XCP_DAQ_ENABLE_ADDR_EXT == XCP_ON
+    entrySize += UINT32(1);
+#endif /* XCP_DAQ_ENABLE_ADDR_EXT */
+#if XCP_DAQ_ENABLE_BIT_OFFSET == XCP_ON
+    entrySize += UINT32(1);
+#endif /* XCP_DAQ_ENABLE_BIT_OFFSET */
+    return XCP_DAQ_IMAGE_HEADER_SIZE + (UINT32(listCount) * XCP_DAQ_IMAGE_LIST_SIZE) +
+        (UINT32(odtCount) * XCP_DAQ_IMAGE_ODT_SIZE) + (UINT32(entryCount) * entrySize) + XCP_DAQ_IMAGE_TRAILER_SIZE;
+}
+
+
+XCP_STATIC uint16_t XcpDaq_ImageChecksum(uint8_t const * image, uint32_t length)
+{
+    uint16_t sum1 = UINT16(0);
+    uint16_t sum2 = UINT16(0);
+    uint32_t idx = UINT32(0);
+
+    for (idx = UINT32(0); idx < length; ++idx) {
+        sum1 = (sum1 + UINT16(image[idx])) % UINT16(255);
+        sum2 = (sum2 + sum1) % UINT16(255);
+    }
+    return XCP_MAKEWORD(sum2, sum1);
+}
+
+
+XCP_STATIC void XcpDaq_PutImageWord(uint8_t * dst, uint16_t value)
+{
+    dst[0] = XCP_LOBYTE(value);
+    dst[1] = XCP_HIBYTE(value);
+}
+
+
+XCP_STATIC uint16_t XcpDaq_GetImageWord(uint8_t const * src)
+{
+    return XCP_MAKEWORD(src[1], src[0]);
+}
+
+
+XCP_STATIC uint16_t XcpDaq_GetEventChannel(XcpDaq_ListIntegerType daqListNumber)
+{
+    uint16_t eventIdx = UINT16(0);
+    uint8_t idx = UINT8(0);
+
+    for (eventIdx = UINT16(0); eventIdx < UINT16(XCP_DAQ_MAX_EVENT_CHANNEL); ++eventIdx) {
+        for (idx = UINT8(0); idx < XcpDaq_ListCountForEvent[eventIdx]; ++idx) {
+            if (XcpDaq_ListsForEvent[eventIdx][idx] == daqListNumber) {
+                return eventIdx;
+            }
+        }
+    }
+    return XCP_DAQ_IMAGE_NO_EVENT;
+}
+#endif /* XCP_DAQ_ENABLE_RESUME */
+
 void XcpDaq_Init(void)
 {
 #if XCP_DAQ_ENABLE_PREDEFINED_LISTS == XCP_ON
     XcpDaq_ListIntegerType idx = 0;
+#endif /* XCP_DAQ_ENABLE_PREDEFINED_LISTS */
 
-    XcpDaq_StopAllLists();
+    XcpDaq_FirstPidsValid = (bool)XCP_FALSE;
+#if XCP_DAQ_ENABLE_PREDEFINED_LISTS == XCP_ON
+    XcpUtl_MemSet(XcpDaq_ListCountForEvent, UINT8(0), UINT32(sizeof(XcpDaq_ListCountForEvent[0]) * UINT16(XCP_DAQ_MAX_EVENT_CHANNEL)));
+    (void)XcpDaq_StopAllLists();
     XcpDaq_SetProcessorState(XCP_DAQ_STATE_STOPPED);
 
     for (idx = (XcpDaq_ListIntegerType)0; idx < XcpDaq_PredefinedListCount; ++idx) {
@@ -260,6 +929,8 @@ void XcpDaq_Init(void)
         XcpDaq_PredefinedListsState[idx].prescaler = UINT8(1);
         XcpDaq_PredefinedListsState[idx].counter = UINT8(0);
 #endif /* XCP_DAQ_ENABLE_PRESCALER */
+        XCP_DAQ_QUEUE_STORE_RELAXED(XcpDaq_PredefinedListsState[idx].overload, UINT8(0));
+        XCP_DAQ_QUEUE_STORE_RELAXED(XcpDaq_PredefinedListsState[idx].overruns, UINT32(0));
     }
 #endif /* XCP_DAQ_ENABLE_PREDEFINED_LISTS */
 
@@ -269,26 +940,34 @@ void XcpDaq_Init(void)
 #endif /* XCP_DAQ_ENABLE_DYNAMIC_LISTS */
 
     XcpDaq_InitMessageQueue();
+#if XCP_DAQ_ENABLE_LOCKED_DTO_BUFFER == XCP_ON
+    /* Locking a region that's already locked is cheap, failure just leaves it pageable. */
+    (void)XcpHw_LockMemory(XcpDaq_DtoQueues, UINT32(sizeof(XcpDaq_DtoQueues)));
+#endif /* XCP_DAQ_ENABLE_LOCKED_DTO_BUFFER */
 }
 
 XcpDaq_ODTEntryType * XcpDaq_GetOdtEntry(XcpDaq_ListIntegerType daqListNumber, XcpDaq_ODTIntegerType odtNumber, XcpDaq_ODTEntryIntegerType odtEntryNumber)
 {
     XcpDaq_ODTType const * odt = XCP_NULL;
-    XcpDaq_ODTIntegerType idx = 0;
+    uint16_t idx = UINT16(0);
 
     /* printf("XcpDaq_GetOdtEntry(()\n"); */
 
     /* TODO: Range checking. */
     odt = XcpDaq_GetOdt(daqListNumber, odtNumber);
-    idx = (XcpDaq_ODTIntegerType)(odt->firstOdtEntry + UINT16(odtEntryNumber));
+    idx = UINT16(odt->firstOdtEntry + UINT16(odtEntryNumber));
 #if (XCP_DAQ_ENABLE_DYNAMIC_LISTS == XCP_ON) && (XCP_DAQ_ENABLE_PREDEFINED_LISTS == XCP_OFF)
     /* Dynamic DAQs only */
-    return &XcpDaq_Entities[idx].entity.odtEntry;
+    return &XcpDaq_DynamicOdtEntries[idx];
 #elif (XCP_DAQ_ENABLE_DYNAMIC_LISTS == XCP_OFF) && (XCP_DAQ_ENABLE_PREDEFINED_LISTS == XCP_ON)
     return (XcpDaq_ODTEntryType *)&XcpDaq_PredefinedOdtEntries[idx];
     /* Predefined DAQs only */
 #elif (XCP_DAQ_ENABLE_DYNAMIC_LISTS == XCP_ON) && (XCP_DAQ_ENABLE_PREDEFINED_LISTS == XCP_ON)
     /* Dynamic and predefined DAQs */
+    if (daqListNumber < XcpDaq_PredefinedListCount) {
+        return (XcpDaq_ODTEntryType *)&XcpDaq_PredefinedOdtEntries[idx];
+    }
+    return &XcpDaq_DynamicOdtEntries[idx];
 #endif // XCP_DAQ_ENABLE_DYNAMIC_LISTS
 }
 
@@ -302,7 +981,7 @@ XcpDaq_ListConfigurationType const * XcpDaq_GetListConfiguration(XcpDaq_ListInte
     //printf("XcpDaq_GetListConfiguration(%u)\n", daqListNumber);
 #if (XCP_DAQ_ENABLE_DYNAMIC_LISTS == XCP_ON) && (XCP_DAQ_ENABLE_PREDEFINED_LISTS == XCP_OFF)
     /* Dynamic DAQs only */
-    XcpDaq_DynamicListType * dl = &XcpDaq_Entities[daqListNumber].entity.daqList;
+    XcpDaq_DynamicListType const * dl = &XcpDaq_DynamicLists[daqListNumber];
 
     XcpDaq_ListConfiguration.firstOdt = dl->firstOdt;
     XcpDaq_ListConfiguration.numOdts = dl->numOdts;
@@ -313,7 +992,16 @@ XcpDaq_ListConfigurationType const * XcpDaq_GetListConfiguration(XcpDaq_ListInte
     return &XcpDaq_PredefinedLists[daqListNumber];
 #elif (XCP_DAQ_ENABLE_DYNAMIC_LISTS == XCP_ON) && (XCP_DAQ_ENABLE_PREDEFINED_LISTS == XCP_ON)
     /* Dynamic and predefined DAQs */
-    return;
+    XcpDaq_DynamicListType const * dl = XCP_NULL;
+
+    if (daqListNumber < XcpDaq_PredefinedListCount) {
+        return &XcpDaq_PredefinedLists[daqListNumber];
+    }
+    dl = &XcpDaq_DynamicLists[XCP_DAQ_DYNAMIC_LIST_INDEX(daqListNumber)];
+    XcpDaq_ListConfiguration.firstOdt = dl->firstOdt;
+    XcpDaq_ListConfiguration.numOdts = dl->numOdts;
+
+    return &XcpDaq_ListConfiguration;
 #endif
 }
 
@@ -327,7 +1015,7 @@ XcpDaq_ListStateType * XcpDaq_GetListState(XcpDaq_ListIntegerType daqListNumber)
     /* printf("XcpDaq_GetListState() number: %u\n", daqListNumber); */
 #if (XCP_DAQ_ENABLE_DYNAMIC_LISTS == XCP_ON) && (XCP_DAQ_ENABLE_PREDEFINED_LISTS == XCP_OFF)
     /* Dynamic DAQs only */
-    return &XcpDaq_ListState;
+    return &XcpDaq_DynamicLists[daqListNumber].state;
 
 #elif (XCP_DAQ_ENABLE_DYNAMIC_LISTS == XCP_OFF) && (XCP_DAQ_ENABLE_PREDEFINED_LISTS == XCP_ON)
     /* Predefined DAQs only */
@@ -335,11 +1023,7 @@ XcpDaq_ListStateType * XcpDaq_GetListState(XcpDaq_ListIntegerType daqListNumber)
 #elif (XCP_DAQ_ENABLE_DYNAMIC_LISTS == XCP_ON) && (XCP_DAQ_ENABLE_PREDEFINED_LISTS == XCP_ON)
     /* Dynamic and predefined DAQs */
     if (daqListNumber >= XcpDaq_PredefinedListCount) {
-        XcpDaq_DynamicListType * dl = &XcpDaq_Entities[daqListNumber].entity.daqList;
-
-        XcpDaq_ListState.mode = dl->mode;
-
-        return &XcpDaq_ListState;
+        return &XcpDaq_DynamicLists[XCP_DAQ_DYNAMIC_LIST_INDEX(daqListNumber)].state;
     } else {
         return &XcpDaq_PredefinedListsState[daqListNumber];
     }
@@ -360,12 +1044,14 @@ bool XcpDaq_ValidateConfiguration(void)
 {
 #if (XCP_DAQ_ENABLE_DYNAMIC_LISTS == XCP_ON) && (XCP_DAQ_ENABLE_PREDEFINED_LISTS == XCP_OFF)
     /* Dynamic DAQs only */
-    return (bool)((XcpDaq_EntityCount > (XCP_DAQ_ENTITY_TYPE)0) && (XcpDaq_ListCount > (XCP_DAQ_ENTITY_TYPE)0) &&  (XcpDaq_OdtCount > (XCP_DAQ_ENTITY_TYPE)0));
+    return (bool)((XcpDaq_ListCount > UINT16(0)) &&  (XcpDaq_OdtCount > UINT16(0)));
 #elif (XCP_DAQ_ENABLE_DYNAMIC_LISTS == XCP_OFF) && (XCP_DAQ_ENABLE_PREDEFINED_LISTS == XCP_ON)
     /* Predefined DAQs only */
     return (bool)XCP_TRUE;
 #elif (XCP_DAQ_ENABLE_DYNAMIC_LISTS == XCP_ON) && (XCP_DAQ_ENABLE_PREDEFINED_LISTS == XCP_ON)
     /* Dynamic and predefined DAQs */
+    return (bool)((XcpDaq_PredefinedListCount > (XcpDaq_ListIntegerType)0) ||
+                  ((XcpDaq_ListCount > UINT16(0)) && (XcpDaq_OdtCount > UINT16(0))));
 #endif
 }
 
@@ -438,181 +1124,1125 @@ void XcpDaq_MainFunction(void)
 {
     Xcp_StateType const * Xcp_State = XCP_NULL;
     XcpDaq_ListIntegerType listCount = 0;
+    XcpDaq_MessageType msg = {0};
 
     Xcp_State = Xcp_GetState();
     if (Xcp_State->daqProcessor.state == XCP_DAQ_STATE_RUNNING) {
         listCount = XcpDaq_GetListCount();   /* Check global state for DAQ/STIM running. */
         /* printf("%u Active DAQ list(s).\n", listCount); */
     }
+#if XCP_DAQ_OVERLOAD_INDICATION == XCP_DAQ_OVERLOAD_INDICATION_EVENT
+    XcpDaq_IndicateOverload();
+#endif /* XCP_DAQ_OVERLOAD_INDICATION */
+    /* Hand queued DTOs to the transport layer without copying. */
+    while (XcpDaq_PeekMessage(&msg)) {
+        Xcp_SendDto(&msg);
+        XcpDaq_ReleaseMessage();
+    }
+#if XCP_ON_ETHERNET_ENABLE_FRAME_BATCHING == XCP_ON
+    Xcp_FlushFrame();
+#endif /* XCP_ON_ETHERNET_ENABLE_FRAME_BATCHING */
 }
 
 XcpDaq_EventType const * XcpDaq_GetEventConfiguration(uint16_t eventChannelNumber)
 {
-    if (eventChannelNumber >= UINT8(XCP_DAQ_MAX_EVENT_CHANNEL)) {
+    if (eventChannelNumber >= UINT16(XCP_DAQ_MAX_EVENT_CHANNEL)) {
         return (XcpDaq_EventType const *)XCP_NULL;
     }
     return &XcpDaq_Events[eventChannelNumber];
 }
 
 
-void XcpDaq_AddEventChannel(XcpDaq_ListIntegerType daqListNumber, uint16_t eventChannelNumber)
+/** @brief Assign a DAQ list to an event channel.
+ *
+ *  A DAQ list is assigned to exactly one event channel, so any previous assignment is dropped.
+ *
+ *  @return XCP_FALSE if the event channel is invalid or already has XCP_DAQ_MAX_LISTS_PER_EVENT lists.
+ */
+bool XcpDaq_AddEventChannel(XcpDaq_ListIntegerType daqListNumber, uint16_t eventChannelNumber)
 {
-#if XCP_DAQ_ENABLE_MULTIPLE_DAQ_LISTS_PER_EVENT  == XCP_OFF
-    XcpDaq_ListForEvent[eventChannelNumber] = daqListNumber;
-#endif /* XCP_DAQ_ENABLE_MULTIPLE_DAQ_LISTS_PER_EVENT */
+    XcpDaq_ListIntegerType * lists = XCP_NULL;
+    uint16_t eventIdx = UINT16(0);
+    uint8_t idx = UINT8(0);
+    uint8_t pos = UINT8(0);
+
+    if (eventChannelNumber >= UINT16(XCP_DAQ_MAX_EVENT_CHANNEL)) {
+        return (bool)XCP_FALSE;
+    }
+    for (eventIdx = UINT16(0); eventIdx < UINT16(XCP_DAQ_MAX_EVENT_CHANNEL); ++eventIdx) {
+        lists = &XcpDaq_ListsForEvent[eventIdx][0];
+        for (idx = UINT8(0); idx < XcpDaq_ListCountForEvent[eventIdx]; ++idx) {
+            if (lists[idx] == daqListNumber) {
+                XcpDaq_ListCountForEvent[eventIdx] -= UINT8(1);
+                for (; idx < XcpDaq_ListCountForEvent[eventIdx]; ++idx) {
+                    lists[idx] = lists[idx + UINT8(1)];
+                }
+                break;
+            }
+        }
+    }
+    lists = &XcpDaq_ListsForEvent[eventChannelNumber][0];
+    if (XcpDaq_ListCountForEvent[eventChannelNumber] >= UINT8(XCP_DAQ_MAX_LISTS_PER_EVENT)) {
+        return (bool)XCP_FALSE;
+    }
+    pos = XcpDaq_ListCountForEvent[eventChannelNumber];
+    while ((pos > UINT8(0)) && (lists[pos - UINT8(1)] > daqListNumber)) {
+        lists[pos] = lists[pos - UINT8(1)];
+        --pos;
+    }
+    lists[pos] = daqListNumber;
+    XcpDaq_ListCountForEvent[eventChannelNumber] += UINT8(1);
+    return (bool)XCP_TRUE;
 }
 
 
-/** @brief Triggers acquisition and transmission of DAQ lists.
+/** @brief Triggers acquisition and transmission of DAQ lists, timestamped with @ref XcpHw_GetTimerCounter.
  *
  *  @param eventChannelNumber   Number of event to trigger.
  */
-void XcpDaq_TriggerEvent(uint8_t eventChannelNumber)
+void XcpDaq_TriggerEvent(uint16_t eventChannelNumber)
 {
-    Xcp_StateType const * state = XCP_NULL;
-    XcpDaq_ListIntegerType daqListNumber = 0;
-    XcpDaq_ODTIntegerType odtIdx = 0;
-    XcpDaq_ODTIntegerType pid = 0;
-    XcpDaq_ODTEntryIntegerType odtEntryIdx = 0;
-    XcpDaq_ODTType const * odt = XCP_NULL;
-    XcpDaq_ODTEntryType * entry = XCP_NULL;
-    XcpDaq_ListConfigurationType const * listConf = XCP_NULL;
+    XcpDaq_GatherPlanType * plan = XcpDaq_EnterActiveEvent(eventChannelNumber);
+    bool published = (bool)XCP_FALSE;
 
-    state = Xcp_GetState();
-    if (state->daqProcessor.state != XCP_DAQ_STATE_RUNNING) {
+    if (plan == XCP_NULL) {
         return;
     }
-    if (eventChannelNumber >= UINT8(XCP_DAQ_MAX_EVENT_CHANNEL)) {
-        return;
+    published = XcpDaq_SampleEvent(plan, eventChannelNumber, XcpHw_GetTimerCounter());
+    XcpDaq_LeavePlan(eventChannelNumber);
+    if (published) {
+        XcpDaq_EventsPublished();
     }
+}
+
+/** @brief Like @ref XcpDaq_TriggerEvent, but with a timestamp the caller already took.
+ *
+ *  @param eventChannelNumber   Number of event to trigger.
+ *  @param timestamp            In units of XCP_DAQ_TIMESTAMP_UNIT (same time base as @ref XcpHw_GetTimerCounter),
+ *                              the lower XCP_DAQ_TIMESTAMP_SIZE bytes are transmitted.
+ */
+void XcpDaq_TriggerEventAt(uint16_t eventChannelNumber, XcpDaq_TimestampType timestamp)
+{
+    XcpDaq_GatherPlanType * plan = XcpDaq_EnterActiveEvent(eventChannelNumber);
+    bool published = (bool)XCP_FALSE;
 
-#if XCP_DAQ_ENABLE_MULTIPLE_DAQ_LISTS_PER_EVENT  == XCP_OFF
-    daqListNumber = XcpDaq_ListForEvent[eventChannelNumber];
-#endif /* XCP_DAQ_ENABLE_MULTIPLE_DAQ_LISTS_PER_EVENT */
-    if (!XcpDaq_GetFirstPid(daqListNumber, &pid)) {
+    if (plan == XCP_NULL) {
         return;
     }
-
-    listConf = XcpDaq_GetListConfiguration(daqListNumber);
-    /* TODO: optimize!!! */
-    for (odtIdx = (XcpDaq_ODTIntegerType)0; odtIdx < listConf->numOdts; ++odtIdx) {
-        odt = XcpDaq_GetOdt(daqListNumber, odtIdx);
-        for (odtEntryIdx = (XcpDaq_ODTEntryIntegerType)0; odtEntryIdx < odt->numOdtEntries; ++odtEntryIdx) {
-            entry = XcpDaq_GetOdtEntry(daqListNumber, odtIdx, odtEntryIdx);
-
-            // XcpDaq_SamplingBuffer
-        }
+    published = XcpDaq_SampleEvent(plan, eventChannelNumber, UINT32(timestamp));
+    XcpDaq_LeavePlan(eventChannelNumber);
+    if (published) {
+        XcpDaq_EventsPublished();
     }
 }
 
-/** @brief Initialize DAQ message queue.
+/** @brief Trigger several events for one instant, e.g. all events due at a scheduler tick.
  *
+ *  All lists get the same timestamp and the transmit task is woken up once for the whole batch.
  *
+ *  @param eventChannelNumbers  Events to trigger, in this order.
+ *  @param count                Number of events.
+ *  @param timestamp            s. @ref XcpDaq_TriggerEventAt
  */
-XCP_STATIC void XcpDaq_InitMessageQueue(void)
+void XcpDaq_TriggerEventsAt(uint16_t const * eventChannelNumbers, uint16_t count, XcpDaq_TimestampType timestamp)
 {
-    XCP_DAQ_ENTER_CRITICAL();
-    XcpDaq_DtoBufferState.numEntries = UINT16(0);
-    XcpDaq_DtoBufferState.front = UINT16(0);
-    XcpDaq_DtoBufferState.back = UINT16(0);
-    XcpDaq_DtoBufferState.allocated = UINT16(0);
-    XCP_DAQ_LEAVE_CRITICAL();
+    XcpDaq_GatherPlanType * plan = XCP_NULL;
+    uint16_t idx = UINT16(0);
+    bool published = (bool)XCP_FALSE;
+
+    for (idx = UINT16(0); idx < count; ++idx) {
+        plan = XcpDaq_EnterActiveEvent(eventChannelNumbers[idx]);
+        if (plan != XCP_NULL) {
+            published |= XcpDaq_SampleEvent(plan, eventChannelNumbers[idx], UINT32(timestamp));
+            XcpDaq_LeavePlan(eventChannelNumbers[idx]);
+        }
+    }
+    if (published) {
+        XcpDaq_EventsPublished();
+    }
 }
 
-/** @brief Post a message to queue.
- *
- * @param[in] msg
+/** @brief Enter the published gather plan on behalf of an event channel, if the DAQ processor is running
+ *  and any list is assigned to the event.
  *
+ *  @return XCP_NULL if there is nothing to sample, otherwise the plan must be left with @ref XcpDaq_LeavePlan.
  */
-bool XcpDaq_EnqueueMessage(XcpDaq_MessageType const * msg)
+XCP_STATIC XcpDaq_GatherPlanType * XcpDaq_EnterActiveEvent(uint16_t eventChannelNumber)
 {
-    uint16_t rhs = 0U;
-    uint16_t lhs = 0U;
+    Xcp_StateType const * state = Xcp_GetState();
+    XcpDaq_GatherPlanType * plan = XCP_NULL;
 
-    XCP_DAQ_ENTER_CRITICAL();
-    if ((XCP_DAQ_MESSAGE_SIZE(msg) + XcpDaq_DtoBufferState.allocated) > UINT16(XCP_DAQ_DTO_BUFFER_SIZE)) {
-        /* Overflow. */
-        XCP_DAQ_LEAVE_CRITICAL();
-        return (bool)XCP_FALSE;
+    if (state->daqProcessor.state != XCP_DAQ_STATE_RUNNING) {
+        return (XcpDaq_GatherPlanType *)XCP_NULL;
     }
-
-    if ((XcpDaq_DtoBufferState.back + XCP_DAQ_MESSAGE_SIZE(msg)) > UINT16(XCP_DAQ_DTO_BUFFER_SIZE)) {
-        /* Wrapping required. */
-        lhs = UINT16(XCP_DAQ_DTO_BUFFER_SIZE) - XcpDaq_DtoBufferState.back;
-        rhs = XCP_DAQ_MESSAGE_SIZE(msg) - lhs;
-        XcpDaq_DtoBuffer[XcpDaq_DtoBufferState.back] = msg->dlc;
-        XcpDaq_DtoBufferState.back += UINT16(1);
-        --lhs;
-        if ((lhs > UINT16(0)) && (lhs)) {
-            XcpUtl_MemCopy(&XcpDaq_DtoBuffer + XcpDaq_DtoBufferState.back, (void *)msg->data, lhs);
-            XcpDaq_DtoBufferState.back += lhs;
-        }
-        XcpUtl_MemCopy(&XcpDaq_DtoBuffer, (void *)msg->data, rhs);
-        XcpDaq_DtoBufferState.back = rhs;
-    } else {
-        XcpDaq_DtoBuffer[XcpDaq_DtoBufferState.back] = msg->dlc;
-        XcpDaq_DtoBufferState.back += UINT16(1);
-        XcpUtl_MemCopy(&XcpDaq_DtoBuffer + XcpDaq_DtoBufferState.back, (void *)msg->data, msg->dlc);
-        XcpDaq_DtoBufferState.back = (XcpDaq_DtoBufferState.back + msg->dlc) % UINT16(XCP_DAQ_DTO_BUFFER_SIZE);
+    if (eventChannelNumber >= UINT16(XCP_DAQ_MAX_EVENT_CHANNEL)) {
+        return (XcpDaq_GatherPlanType *)XCP_NULL;
     }
-    XcpDaq_DtoBufferState.allocated += XCP_DAQ_MESSAGE_SIZE(msg);
-    XCP_DAQ_LEAVE_CRITICAL();
-    return (bool)XCP_TRUE;
+    plan = XcpDaq_EnterPlan(eventChannelNumber);
+    if (plan->events[eventChannelNumber].numLists == UINT16(0)) {
+        XcpDaq_LeavePlan(eventChannelNumber);
+        return (XcpDaq_GatherPlanType *)XCP_NULL;
+    }
+    return plan;
 }
 
-/** @brief Take a message from queue.
- *
- * @param[out] msg
+/** @brief Sample the lists of an event into the DTO queues.
  *
+ *  @return XCP_TRUE if any DTO was queued.
  */
-bool XcpDaq_DequeueMessage(XcpDaq_MessageType * msg)
+XCP_STATIC bool XcpDaq_SampleEvent(XcpDaq_GatherPlanType * plan, uint16_t eventChannelNumber, uint32_t timestamp)
 {
-    uint16_t rhs = 0U;
-    uint16_t lhs = 0U;
-
-    XCP_DAQ_ENTER_CRITICAL();
-    if (XcpDaq_DtoBufferState.front == XcpDaq_DtoBufferState.back) {
-        XCP_DAQ_LEAVE_CRITICAL();
+    XcpDaq_GatherEventType const * event = &plan->events[eventChannelNumber];
+    XcpDaq_GatherListType const * list = XCP_NULL;
+    XcpDaq_GatherOdtType const * odt = XCP_NULL;
+    XcpDaq_GatherEntryType const * entry = XCP_NULL;
+    XcpDaq_GatherEntryType const * lastEntry = XCP_NULL;
+    uint8_t * dto = XCP_NULL;
+    uint16_t listIdx = UINT16(0);
+    uint16_t odtIdx = UINT16(0);
+    bool published = (bool)XCP_FALSE;
+    bool due[XCP_DAQ_MAX_LISTS_PER_EVENT];
+    bool anyDue = (bool)XCP_FALSE;
+
+    /* Lists skipped by their prescaler cost neither a snapshot nor a copy. */
+    for (listIdx = UINT16(0); listIdx < event->numLists; ++listIdx) {
+        due[listIdx] = XcpDaq_AdvancePrescaler(plan->lists[event->firstList + listIdx].state);
+        anyDue |= due[listIdx];
+    }
+    if (!anyDue) {
         return (bool)XCP_FALSE;
     }
-    msg->dlc = XcpDaq_DtoBuffer[XcpDaq_DtoBufferState.front];
-    if ((XcpDaq_DtoBufferState.front + XCP_DAQ_MESSAGE_SIZE(msg)) > UINT16(XCP_DAQ_DTO_BUFFER_SIZE)) {
-        /* Wrapping required. */
-        lhs = UINT16(XCP_DAQ_DTO_BUFFER_SIZE) - XcpDaq_DtoBufferState.front;
-        rhs = XCP_DAQ_MESSAGE_SIZE(msg) - lhs;
-        msg->dlc = XcpDaq_DtoBuffer[XcpDaq_DtoBufferState.front];
-        XcpDaq_DtoBufferState.front += UINT16(1);
-        --lhs;
-        if ((lhs > UINT16(0)) && (lhs)) {
-            XcpUtl_MemCopy((void *)msg->data, &XcpDaq_DtoBuffer + XcpDaq_DtoBufferState.front, lhs);
-            XcpDaq_DtoBufferState.front += lhs;
-        }
-        XcpUtl_MemCopy((void *)msg->data, &XcpDaq_DtoBuffer, rhs);
-        XcpDaq_DtoBufferState.front = rhs;
-    } else {
-        msg-> dlc = XcpDaq_DtoBuffer[XcpDaq_DtoBufferState.front];
-        XcpDaq_DtoBufferState.front += UINT16(1);
-        XcpUtl_MemCopy((void *)msg->data, &XcpDaq_DtoBuffer + XcpDaq_DtoBufferState.front, msg->dlc);
-        XcpDaq_DtoBufferState.front = (XcpDaq_DtoBufferState.front + msg->dlc) % UINT16(XCP_DAQ_DTO_BUFFER_SIZE);
+
+#if XCP_DAQ_ENABLE_SEQLOCK == XCP_ON
+    if ((event->lock != XCP_NULL) && !XcpDaq_TakeSnapshot(plan, event, due)) {
+        XCP_DAQ_QUEUE_STORE_RELAXED(XcpDaq_SeqLockSkips[eventChannelNumber],
+            XCP_DAQ_QUEUE_LOAD_RELAXED(XcpDaq_SeqLockSkips[eventChannelNumber]) + UINT32(1));
+        return (bool)XCP_FALSE;
     }
-    XcpDaq_DtoBufferState.allocated -= XCP_DAQ_MESSAGE_SIZE(msg);
-    XCP_DAQ_LEAVE_CRITICAL();
-    return (bool)XCP_TRUE;
-}
+#endif /* XCP_DAQ_ENABLE_SEQLOCK */
 
-#if 0
-bool XcpDaq_MessageQueueEmpty(void)
-{
-    return (XcpDaq_DtoBufferState.front == XcpDaq_DtoBufferState.back);
+    for (listIdx = event->firstList; listIdx < (event->firstList + event->numLists); ++listIdx) {
+        list = &plan->lists[listIdx];
+        if (!due[listIdx - event->firstList]) {
+            continue;
+        }
+#if XCP_ENABLE_STIM == XCP_ON
+        if (list->stim != XCP_NULL) {
+            XcpDaq_ApplyStim(plan, list, timestamp);
+            continue;
+        }
+#endif /* XCP_ENABLE_STIM */
+        for (odtIdx = list->firstOdt; odtIdx < (list->firstOdt + list->numOdts); ++odtIdx) {
+            odt = &plan->odts[odtIdx];
+            /* Build the DTO in place. */
+            dto = XcpDaq_ReserveMessage(eventChannelNumber, list->priority, UINT8(odt->length));
+            if (dto == XCP_NULL) {
+                /* Overrun: drop the rest of this list, the next lists may go to other queues. */
+                XCP_DAQ_QUEUE_STORE_RELAXED(list->state->overload, UINT8(1));
+                XCP_DAQ_QUEUE_STORE_RELAXED(list->state->overruns, XCP_DAQ_QUEUE_LOAD_RELAXED(list->state->overruns) + UINT32(1));
+                break;
+            }
+            if ((odt->header & XCP_DAQ_GATHER_HEADER_PID) == XCP_DAQ_GATHER_HEADER_PID) {
+                dto[0] = odt->pid;
+            }
+            if ((odt->header & XCP_DAQ_GATHER_HEADER_TIMESTAMP) == XCP_DAQ_GATHER_HEADER_TIMESTAMP) {
+                XcpDaq_PutTimestamp(&dto[odt->header & XCP_DAQ_GATHER_HEADER_PID], timestamp);
+            }
+            entry = &plan->entries[odt->firstEntry];
+            lastEntry = entry + odt->numEntries;
+#if XCP_DAQ_REMOTE_SAMPLING == XCP_ON
+            if (((odt->header & XCP_DAQ_GATHER_HEADER_REMOTE) == XCP_DAQ_GATHER_HEADER_REMOTE) && (odt->numEntries > UINT16(0))) {
+                /* All entries of the ODT with a single read. */
+                if (!XcpHw_ReadRemoteMemory(&dto[entry->offset], &plan->remoteSegments[odt->firstEntry], odt->numEntries)) {
+                    /* The reservation is reused by the next DTO. */
+                    XCP_DAQ_QUEUE_STORE_RELAXED(XcpDaq_RemoteReadErrors[eventChannelNumber],
+                        XCP_DAQ_QUEUE_LOAD_RELAXED(XcpDaq_RemoteReadErrors[eventChannelNumber]) + UINT32(1));
+                    continue;
+                }
+                entry = lastEntry;
+            }
+#endif /* XCP_DAQ_REMOTE_SAMPLING */
+#if XCP_DAQ_ENABLE_SEQLOCK == XCP_ON
+            if ((event->lock != XCP_NULL) && (odt->numEntries > UINT16(0))) {
+                /* Entries are packed back to back up to the end of the DTO. */
+                XcpUtl_MemCopy(&dto[entry->offset], &plan->snapshotPool[odt->snapshotOffset + entry->offset],
+                               UINT32(odt->length - entry->offset)
+                );
+                entry = lastEntry;
+            }
+#endif /* XCP_DAQ_ENABLE_SEQLOCK */
+#if XCP_DAQ_ENABLE_PREDEFINED_SAMPLERS == XCP_ON
+            if ((odt->sample != XCP_NULL) && (entry < lastEntry)) {
+                odt->sample(&dto[entry->offset]);
+                entry = lastEntry;
+            }
+#endif /* XCP_DAQ_ENABLE_PREDEFINED_SAMPLERS */
+            for (; entry < lastEntry; ++entry) {
+                XcpUtl_SampleCopy(&dto[entry->offset], entry->address, UINT32(entry->length));
+            }
+#if XCP_DAQ_OVERLOAD_INDICATION == XCP_DAQ_OVERLOAD_INDICATION_PID
+            /* Only a DTO actually sent carries the indication away. */
+            if (((odt->header & XCP_DAQ_GATHER_HEADER_PID) == XCP_DAQ_GATHER_HEADER_PID) && (XCP_DAQ_QUEUE_LOAD_RELAXED(list->state->overload) != UINT8(0))) {
+                dto[0] |= XCP_DAQ_OVERLOAD_PID_MSB;
+                XCP_DAQ_QUEUE_STORE_RELAXED(list->state->overload, UINT8(0));
+            }
+#endif /* XCP_DAQ_OVERLOAD_INDICATION */
+            XcpDaq_PublishMessage(eventChannelNumber, list->priority, UINT8(odt->length));
+            published = (bool)XCP_TRUE;
+        }
+    }
+    return published;
 }
 
-bool XcpDaq_MessageQueueFull(void)
+/** @brief Count an event against the prescaler of a list.
+ *
+ *  @return XCP_TRUE if the list is sampled on this event: every prescaler-th one,
+ *          starting with the first event after the list was started.
+ */
+XCP_STATIC bool XcpDaq_AdvancePrescaler(XcpDaq_ListStateType * state)
 {
-    return (XcpDaq_DtoBufferState.back == (
-        (XcpDaq_DtoBufferState.front - 1 + XCP_DAQ_DTO_BUFFER_SIZE) % XCP_DAQ_DTO_BUFFER_SIZE)
-    );
-}
-#endif // 0
+#if XCP_DAQ_ENABLE_PRESCALER == XCP_ON
+    if (state->prescaler > UINT8(1)) {
+        if (state->counter != UINT8(0)) {
+            state->counter = (state->counter + UINT8(1)) % state->prescaler;
+            return (bool)XCP_FALSE;
+        }
+        state->counter = UINT8(1);
+    }
+#else
+    (void)state;
+#endif /* XCP_DAQ_ENABLE_PRESCALER */
+    return (bool)XCP_TRUE;
+}
+
+/** @brief Called once DTOs of one or more events are queued.
+ */
+XCP_STATIC void XcpDaq_EventsPublished(void)
+{
+#if XCP_DAQ_ENABLE_TRANSMIT_TASK == XCP_ON
+    /* One wake-up for all DTOs of the event(s). */
+    XcpDaq_NotifyTransmitter();
+#endif /* XCP_DAQ_ENABLE_TRANSMIT_TASK */
+}
+
+/** @brief Initialize DAQ message queues and transmit schedule.
+ *
+ *
+ */
+XCP_STATIC void XcpDaq_InitMessageQueue(void)
+{
+    uint16_t idx = UINT16(0);
+    uint16_t pos = UINT16(0);
+    uint16_t eventChannelNumber = UINT16(0);
+    uint16_t priorityClass = UINT16(0);
+    uint8_t priority = UINT8(0);
+
+    XCP_DAQ_QUEUE_ENTER_CRITICAL();
+    for (priorityClass = UINT16(0); priorityClass < UINT16(XCP_DAQ_PRIORITY_CLASSES); ++priorityClass) {
+        for (idx = UINT16(0); idx < UINT16(XCP_DAQ_MAX_EVENT_CHANNEL); ++idx) {
+            XCP_DAQ_QUEUE_STORE_RELEASE(XcpDaq_DtoQueues[priorityClass][idx].state.front, XCP_DAQ_DTO_INDEX(0));
+            XCP_DAQ_QUEUE_STORE_RELEASE(XcpDaq_DtoQueues[priorityClass][idx].state.back, XCP_DAQ_DTO_INDEX(0));
+            XCP_DAQ_QUEUE_STORE_RELAXED(XcpDaq_DtoQueues[priorityClass][idx].dropped, UINT32(0));
+            XcpDaq_DtoQueueGroupNext[priorityClass][idx] = UINT16(0);
+        }
+    }
+#if (XCP_DAQ_ENABLE_SEQLOCK == XCP_ON) || (XCP_DAQ_REMOTE_SAMPLING == XCP_ON)
+    for (idx = UINT16(0); idx < UINT16(XCP_DAQ_MAX_EVENT_CHANNEL); ++idx) {
+#if XCP_DAQ_ENABLE_SEQLOCK == XCP_ON
+        XCP_DAQ_QUEUE_STORE_RELAXED(XcpDaq_SeqLockSkips[idx], UINT32(0));
+#endif /* XCP_DAQ_ENABLE_SEQLOCK */
+#if XCP_DAQ_REMOTE_SAMPLING == XCP_ON
+        XCP_DAQ_QUEUE_STORE_RELAXED(XcpDaq_RemoteReadErrors[idx], UINT32(0));
+#endif /* XCP_DAQ_REMOTE_SAMPLING */
+    }
+#endif /* XCP_DAQ_ENABLE_SEQLOCK || XCP_DAQ_REMOTE_SAMPLING */
+    XcpDaq_DtoQueuePeeked = (XcpDaq_DtoQueueType *)XCP_NULL;
+#if XCP_DAQ_OVERLOAD_INDICATION == XCP_DAQ_OVERLOAD_INDICATION_EVENT
+    XcpDaq_OverrunsIndicated = UINT32(0);
+#endif /* XCP_DAQ_OVERLOAD_INDICATION */
+    XCP_DAQ_QUEUE_LEAVE_CRITICAL();
+
+    /* Stable insertion sort by descending event priority. */
+    for (idx = UINT16(0); idx < UINT16(XCP_DAQ_MAX_EVENT_CHANNEL); ++idx) {
+        priority = XcpDaq_GetEventConfiguration(idx)->priority;
+        for (pos = idx; pos > UINT16(0); --pos) {
+            eventChannelNumber = XcpDaq_DtoQueueOrder[pos - UINT16(1)];
+            if (XcpDaq_GetEventConfiguration(eventChannelNumber)->priority >= priority) {
+                break;
+            }
+            XcpDaq_DtoQueueOrder[pos] = eventChannelNumber;
+        }
+        XcpDaq_DtoQueueOrder[pos] = idx;
+    }
+    for (idx = UINT16(XCP_DAQ_MAX_EVENT_CHANNEL); idx > UINT16(0); --idx) {
+        pos = idx - UINT16(1);
+        if ((idx == UINT16(XCP_DAQ_MAX_EVENT_CHANNEL)) ||
+            (XcpDaq_GetEventConfiguration(XcpDaq_DtoQueueOrder[pos])->priority != XcpDaq_GetEventConfiguration(XcpDaq_DtoQueueOrder[idx])->priority)) {
+            XcpDaq_DtoQueueGroupEnd[pos] = idx;
+        } else {
+            XcpDaq_DtoQueueGroupEnd[pos] = XcpDaq_DtoQueueGroupEnd[idx];
+        }
+    }
+}
+
+/** @brief Enter the published gather plan; the plan isn't reused until @ref XcpDaq_LeavePlan.
+ *
+ *  Never waits for the writer of a new plan.
+ *
+ * @param[in] user  Event channel number or XCP_DAQ_PLAN_USER_STIM; each user is a single context.
+ */
+XCP_STATIC XcpDaq_GatherPlanType * XcpDaq_EnterPlan(uint16_t user)
+{
+    uint8_t active = UINT8(0);
+
+#if XCP_DAQ_ENABLE_LOCK_FREE_DTO_QUEUE == XCP_ON
+    /* Sequentially consistent: either the writer sees the user, or the user sees the newer plan and retries. */
+    do {
+        active = atomic_load(&XcpDaq_ActivePlan);
+        atomic_store(&XcpDaq_PlanUsers[user], UINT8(active + UINT8(1)));
+    } while (atomic_load(&XcpDaq_ActivePlan) != active);
+#else
+    XCP_DAQ_ENTER_CRITICAL();
+    active = XcpDaq_ActivePlan;
+    XcpDaq_PlanUsers[user] = UINT8(active + UINT8(1));
+    XCP_DAQ_LEAVE_CRITICAL();
+#endif /* XCP_DAQ_ENABLE_LOCK_FREE_DTO_QUEUE */
+    return &XcpDaq_GatherPlans[active];
+}
+
+XCP_STATIC void XcpDaq_LeavePlan(uint16_t user)
+{
+#if XCP_DAQ_ENABLE_LOCK_FREE_DTO_QUEUE == XCP_ON
+    atomic_store_explicit(&XcpDaq_PlanUsers[user], UINT8(0), memory_order_release);
+#else
+    XCP_DAQ_ENTER_CRITICAL();
+    XcpDaq_PlanUsers[user] = UINT8(0);
+    XCP_DAQ_LEAVE_CRITICAL();
+#endif /* XCP_DAQ_ENABLE_LOCK_FREE_DTO_QUEUE */
+}
+
+/** @brief Become the only writer of the gather plans; the active plan is neither replaced nor
+ *  the inactive one reset until @ref XcpDaq_ReleasePlan.
+ *
+ * @return XCP_FALSE if another writer owns the plans.
+ */
+XCP_STATIC bool XcpDaq_LockPlans(void)
+{
+    bool busy = (bool)XCP_FALSE;
+
+#if XCP_DAQ_ENABLE_LOCK_FREE_DTO_QUEUE == XCP_ON
+    busy = (atomic_exchange(&XcpDaq_PlanWriter, UINT8(1)) != UINT8(0));
+#else
+    XCP_DAQ_ENTER_CRITICAL();
+    busy = (XcpDaq_PlanWriter != UINT8(0));
+    XcpDaq_PlanWriter = UINT8(1);
+    XCP_DAQ_LEAVE_CRITICAL();
+#endif /* XCP_DAQ_ENABLE_LOCK_FREE_DTO_QUEUE */
+    return !busy;
+}
+
+/** @brief Take the inactive gather plan for compilation, once no producer samples it anymore.
+ *
+ *  Writers are serialized: the plan is owned until @ref XcpDaq_PublishPlan or @ref XcpDaq_ReleasePlan.
+ *  Producers are polled XCP_DAQ_PLAN_ACQUIRE_RETRIES times; usually they left long before,
+ *  the plan was replaced by an earlier command.
+ *
+ * @return The reset plan, or XCP_NULL if another writer owns it or a producer didn't leave in time.
+ */
+XCP_STATIC XcpDaq_GatherPlanType * XcpDaq_AcquireInactivePlan(void)
+{
+    XcpDaq_GatherPlanType * plan = XCP_NULL;
+    uint32_t retry = UINT32(0);
+    uint16_t user = UINT16(0);
+    uint8_t inactive = UINT8(0);
+
+    if (!XcpDaq_LockPlans()) {
+        return XCP_NULL;
+    }
+    for (retry = UINT32(0); retry < UINT32(XCP_DAQ_PLAN_ACQUIRE_RETRIES); ++retry) {
+#if XCP_DAQ_ENABLE_LOCK_FREE_DTO_QUEUE == XCP_ON
+        inactive = UINT8(UINT8(1) - atomic_load(&XcpDaq_ActivePlan));
+        for (user = UINT16(0); user < UINT16(XCP_DAQ_PLAN_USERS); ++user) {
+            if (atomic_load(&XcpDaq_PlanUsers[user]) == UINT8(inactive + UINT8(1))) {
+                break;
+            }
+        }
+#else
+        XCP_DAQ_ENTER_CRITICAL();
+        inactive = UINT8(UINT8(1) - XcpDaq_ActivePlan);
+        for (user = UINT16(0); user < UINT16(XCP_DAQ_PLAN_USERS); ++user) {
+            if (XcpDaq_PlanUsers[user] == UINT8(inactive + UINT8(1))) {
+                break;
+            }
+        }
+        XCP_DAQ_LEAVE_CRITICAL();
+#endif /* XCP_DAQ_ENABLE_LOCK_FREE_DTO_QUEUE */
+        if (user == UINT16(XCP_DAQ_PLAN_USERS)) {
+            plan = &XcpDaq_GatherPlans[inactive];
+            XcpDaq_ResetGatherPlan(plan);
+            return plan;
+        }
+    }
+    XcpDaq_ReleasePlan();
+    return XCP_NULL;
+}
+
+/** @brief Make a compiled plan the one sampled by subsequent events and give up its ownership.
+ */
+XCP_STATIC void XcpDaq_PublishPlan(XcpDaq_GatherPlanType const * plan)
+{
+#if XCP_DAQ_ENABLE_LOCK_FREE_DTO_QUEUE == XCP_ON
+    atomic_store(&XcpDaq_ActivePlan, UINT8(plan - &XcpDaq_GatherPlans[0]));
+#else
+    XCP_DAQ_ENTER_CRITICAL();
+    XcpDaq_ActivePlan = UINT8(plan - &XcpDaq_GatherPlans[0]);
+    XCP_DAQ_LEAVE_CRITICAL();
+#endif /* XCP_DAQ_ENABLE_LOCK_FREE_DTO_QUEUE */
+    XcpDaq_ReleasePlan();
+}
+
+/** @brief Give up the ownership of the plans without publishing one.
+ */
+XCP_STATIC void XcpDaq_ReleasePlan(void)
+{
+#if XCP_DAQ_ENABLE_LOCK_FREE_DTO_QUEUE == XCP_ON
+    atomic_store_explicit(&XcpDaq_PlanWriter, UINT8(0), memory_order_release);
+#else
+    XCP_DAQ_ENTER_CRITICAL();
+    XcpDaq_PlanWriter = UINT8(0);
+    XCP_DAQ_LEAVE_CRITICAL();
+#endif /* XCP_DAQ_ENABLE_LOCK_FREE_DTO_QUEUE */
+}
+
+/** @brief Discard a compiled gather plan.
+ */
+XCP_STATIC void XcpDaq_ResetGatherPlan(XcpDaq_GatherPlanType * plan)
+{
+    XcpUtl_MemSet(plan->events, UINT8(0), UINT32(sizeof(plan->events[0]) * UINT16(XCP_DAQ_MAX_EVENT_CHANNEL)));
+    plan->listCount = UINT16(0);
+    plan->odtCount = UINT16(0);
+    plan->entryCount = UINT16(0);
+#if XCP_ENABLE_STIM == XCP_ON
+    plan->stimListCount = UINT8(0);
+    plan->stimPoolUsed = UINT16(0);
+#endif /* XCP_ENABLE_STIM */
+#if XCP_DAQ_ENABLE_SEQLOCK == XCP_ON
+    plan->snapshotPoolUsed = UINT16(0);
+#endif /* XCP_DAQ_ENABLE_SEQLOCK */
+}
+
+/** @brief Reserve contiguous space for a DTO in a queue of an event channel.
+ *
+ *  The DTO is built in place and published by @ref XcpDaq_CommitMessage; room for the
+ *  transport layer header is kept in front of the returned pointer.
+ *  Each event channel must only be triggered from one producer context at a time; never blocks.
+ *
+ * @param[in] eventChannelNumber
+ * @param[in] priority  DAQ list priority, selects the priority class.
+ * @param[in] dlc       Maximum length of the DTO.
+ * @return  Pointer to the first byte of the DTO or NULL on overflow.
+ */
+uint8_t * XcpDaq_ReserveMessage(uint16_t eventChannelNumber, uint8_t priority, uint8_t dlc)
+{
+    XcpDaq_DtoQueueType * queue = XCP_NULL;
+    XCP_DAQ_DTO_INDEX_TYPE front = XCP_DAQ_DTO_INDEX(0);
+    XCP_DAQ_DTO_INDEX_TYPE back = XCP_DAQ_DTO_INDEX(0);
+    XCP_DAQ_DTO_INDEX_TYPE tail = XCP_DAQ_DTO_INDEX(0);
+    XCP_DAQ_DTO_INDEX_TYPE required = XCP_DAQ_DTO_INDEX(XCP_DAQ_RECORD_SIZE(dlc));
+
+    if ((eventChannelNumber >= UINT16(XCP_DAQ_MAX_EVENT_CHANNEL)) || (dlc == UINT8(0))) {
+        return (uint8_t *)XCP_NULL;
+    }
+    queue = &XcpDaq_DtoQueues[XCP_DAQ_PRIORITY_CLASS(priority)][eventChannelNumber];
+    XCP_DAQ_QUEUE_ENTER_CRITICAL();
+    back = XCP_DAQ_QUEUE_LOAD_RELAXED(queue->state.back);
+    front = XCP_DAQ_QUEUE_LOAD_ACQUIRE(queue->state.front);
+    XCP_DAQ_QUEUE_LEAVE_CRITICAL();
+    tail = XCP_DAQ_DTO_INDEX(XCP_DAQ_DTO_BUFFER_SIZE) - (back & XCP_DAQ_DTO_BUFFER_MASK);
+    if (required > tail) {
+        /* Records never wrap, skip the tail of the buffer. */
+        required += tail;
+    }
+    if ((XCP_DAQ_DTO_INDEX(back - front) + required) > XCP_DAQ_DTO_INDEX(XCP_DAQ_DTO_BUFFER_SIZE)) {
+        /* Overflow. */
+        /* Single writer, a plain load/store pair doesn't need a read-modify-write. */
+        XCP_DAQ_QUEUE_STORE_RELAXED(queue->dropped, XCP_DAQ_QUEUE_LOAD_RELAXED(queue->dropped) + UINT32(1));
+        return (uint8_t *)XCP_NULL;
+    }
+    if (required > XCP_DAQ_DTO_INDEX(XCP_DAQ_RECORD_SIZE(dlc))) {
+        queue->buffer[back & XCP_DAQ_DTO_BUFFER_MASK] = XCP_DAQ_RECORD_WRAP;
+        back += tail;
+    }
+    queue->reserved = back;
+    return &queue->buffer[(back & XCP_DAQ_DTO_BUFFER_MASK) + UINT32(1) + UINT32(XCP_TRANSPORT_LAYER_BUFFER_OFFSET)];
+}
+
+/** @brief Publish the DTO built by the preceding @ref XcpDaq_ReserveMessage.
+ *
+ * @param[in] eventChannelNumber
+ * @param[in] priority
+ * @param[in] dlc   Actual length of the DTO, must not exceed the reserved length.
+ */
+void XcpDaq_CommitMessage(uint16_t eventChannelNumber, uint8_t priority, uint8_t dlc)
+{
+    XcpDaq_PublishMessage(eventChannelNumber, priority, dlc);
+#if XCP_DAQ_ENABLE_TRANSMIT_TASK == XCP_ON
+    XcpDaq_NotifyTransmitter();
+#endif /* XCP_DAQ_ENABLE_TRANSMIT_TASK */
+}
+
+/** @brief Post a copy of a message to the queue of an event channel.
+ *
+ * @param[in] eventChannelNumber
+ * @param[in] priority
+ * @param[in] msg
+ *
+ */
+bool XcpDaq_EnqueueMessage(uint16_t eventChannelNumber, uint8_t priority, XcpDaq_MessageType const * msg)
+{
+    uint8_t * dto = XcpDaq_ReserveMessage(eventChannelNumber, priority, msg->dlc);
+
+    if (dto == XCP_NULL) {
+        return (bool)XCP_FALSE;
+    }
+    XcpUtl_MemCopy(dto, msg->data, UINT32(msg->dlc));
+    XcpDaq_CommitMessage(eventChannelNumber, priority, msg->dlc);
+    return (bool)XCP_TRUE;
+}
+
+/** @brief Get the next message to transmit without removing it from its queue.
+ *
+ *  Merges the queues: higher priority classes are always served first, then higher priority
+ *  event channels, event channels of equal priority round-robin. Messages of one event channel (and thus of one DAQ list)
+ *  keep their order.
+ *  `msg->data` points into the queue; the XCP_TRANSPORT_LAYER_BUFFER_OFFSET bytes in front of it are
+ *  reserved for the transport layer header. The message stays valid until @ref XcpDaq_ReleaseMessage.
+ *  Must only be called from one consumer context at a time; never blocks.
+ *
+ * @param[out] msg
+ *
+ */
+bool XcpDaq_PeekMessage(XcpDaq_MessageType * msg)
+{
+    XcpDaq_DtoQueueType * queues = XCP_NULL;
+    uint16_t * groupNext = XCP_NULL;
+    uint16_t priorityClass = UINT16(0);
+    uint16_t pos = UINT16(0);
+    uint16_t end = UINT16(0);
+    uint16_t size = UINT16(0);
+    uint16_t idx = UINT16(0);
+    uint16_t slot = UINT16(0);
+
+    for (priorityClass = UINT16(XCP_DAQ_PRIORITY_CLASSES); priorityClass > UINT16(0); --priorityClass) {
+        queues = &XcpDaq_DtoQueues[priorityClass - UINT16(1)][0];
+        groupNext = &XcpDaq_DtoQueueGroupNext[priorityClass - UINT16(1)][0];
+        for (pos = UINT16(0); pos < UINT16(XCP_DAQ_MAX_EVENT_CHANNEL); pos = end) {
+            end = XcpDaq_DtoQueueGroupEnd[pos];
+            size = end - pos;
+            for (idx = UINT16(0); idx < size; ++idx) {
+                slot = pos + ((groupNext[pos] + idx) % size);
+                if (XcpDaq_PeekQueue(&queues[XcpDaq_DtoQueueOrder[slot]], msg)) {
+                    groupNext[pos] = ((slot - pos) + UINT16(1)) % size;
+                    XcpDaq_DtoQueuePeeked = &queues[XcpDaq_DtoQueueOrder[slot]];
+                    return (bool)XCP_TRUE;
+                }
+            }
+        }
+    }
+    return (bool)XCP_FALSE;
+}
+
+/** @brief Remove the message returned by the preceding @ref XcpDaq_PeekMessage from its queue.
+ *
+ *
+ */
+void XcpDaq_ReleaseMessage(void)
+{
+    XcpDaq_DtoQueueType * queue = XcpDaq_DtoQueuePeeked;
+    XCP_DAQ_DTO_INDEX_TYPE front = XCP_DAQ_DTO_INDEX(0);
+
+    if (queue == XCP_NULL) {
+        return;
+    }
+    XcpDaq_DtoQueuePeeked = XCP_NULL;
+    XCP_DAQ_QUEUE_ENTER_CRITICAL();
+    front = XCP_DAQ_QUEUE_LOAD_RELAXED(queue->state.front);
+    XCP_DAQ_QUEUE_STORE_RELEASE(queue->state.front, XCP_DAQ_DTO_INDEX(front + XCP_DAQ_RECORD_SIZE(queue->buffer[front & XCP_DAQ_DTO_BUFFER_MASK])));
+    XCP_DAQ_QUEUE_LEAVE_CRITICAL();
+}
+
+/** @brief Take a copy of the next message to transmit.
+ *
+ * @param[out] msg  `msg->data` must point to a buffer of at least XCP_MAX_DTO bytes.
+ *
+ */
+bool XcpDaq_DequeueMessage(XcpDaq_MessageType * msg)
+{
+    XcpDaq_MessageType peeked = {0};
+
+    if (!XcpDaq_PeekMessage(&peeked)) {
+        return (bool)XCP_FALSE;
+    }
+    msg->dlc = peeked.dlc;
+    XcpUtl_MemCopy((void *)msg->data, peeked.data, UINT32(peeked.dlc));
+    XcpDaq_ReleaseMessage();
+    return (bool)XCP_TRUE;
+}
+
+/** @brief Report fill level and overflow count of a priority class, summed over all event channels.
+ *
+ * @param[in] priorityClass     0 .. XCP_DAQ_PRIORITY_CLASSES - 1
+ * @param[out] stats
+ *
+ */
+void XcpDaq_GetQueueStatistics(uint8_t priorityClass, XcpDaq_QueueStatisticsType * stats)
+{
+    XcpDaq_DtoQueueType const * queue = XCP_NULL;
+    uint16_t idx = UINT16(0);
+
+    stats->depth = UINT32(0);
+    stats->dropped = UINT32(0);
+    if (UINT16(priorityClass) >= UINT16(XCP_DAQ_PRIORITY_CLASSES)) {
+        return;
+    }
+    for (idx = UINT16(0); idx < UINT16(XCP_DAQ_MAX_EVENT_CHANNEL); ++idx) {
+        queue = &XcpDaq_DtoQueues[priorityClass][idx];
+        XCP_DAQ_QUEUE_ENTER_CRITICAL();
+        stats->depth += UINT32(XCP_DAQ_DTO_INDEX(XCP_DAQ_QUEUE_LOAD_ACQUIRE(queue->state.back) - XCP_DAQ_QUEUE_LOAD_ACQUIRE(queue->state.front)));
+        XCP_DAQ_QUEUE_LEAVE_CRITICAL();
+        stats->dropped += XCP_DAQ_QUEUE_LOAD_RELAXED(queue->dropped);
+    }
+}
+
+/** @brief Get the number of DTOs of a DAQ list lost due to DTO buffer overflows since the list was started.
+ *
+ * @param[in] daqListNumber
+ *
+ */
+uint32_t XcpDaq_GetListOverruns(XcpDaq_ListIntegerType daqListNumber)
+{
+    if (daqListNumber >= XcpDaq_GetListCount()) {
+        return UINT32(0);
+    }
+    return XCP_DAQ_QUEUE_LOAD_RELAXED(XcpDaq_GetListState(daqListNumber)->overruns);
+}
+
+/** @brief Get the number of DTOs of an event channel lost due to DTO buffer overflows, all priority classes.
+ *
+ * @param[in] eventChannelNumber
+ *
+ */
+uint32_t XcpDaq_GetEventOverruns(uint16_t eventChannelNumber)
+{
+    uint32_t overruns = UINT32(0);
+    uint16_t priorityClass = UINT16(0);
+
+    if (eventChannelNumber >= UINT16(XCP_DAQ_MAX_EVENT_CHANNEL)) {
+        return UINT32(0);
+    }
+    for (priorityClass = UINT16(0); priorityClass < UINT16(XCP_DAQ_PRIORITY_CLASSES); ++priorityClass) {
+        overruns += XCP_DAQ_QUEUE_LOAD_RELAXED(XcpDaq_DtoQueues[priorityClass][eventChannelNumber].dropped);
+    }
+    return overruns;
+}
+
+#if XCP_DAQ_REMOTE_SAMPLING == XCP_ON
+/** @brief Get the number of DTOs of an event channel lost because target process memory couldn't be read.
+ *
+ * @param[in] eventChannelNumber
+ *
+ */
+uint32_t XcpDaq_GetRemoteReadErrors(uint16_t eventChannelNumber)
+{
+    if (eventChannelNumber >= UINT16(XCP_DAQ_MAX_EVENT_CHANNEL)) {
+        return UINT32(0);
+    }
+    return XCP_DAQ_QUEUE_LOAD_RELAXED(XcpDaq_RemoteReadErrors[eventChannelNumber]);
+}
+#endif /* XCP_DAQ_REMOTE_SAMPLING */
+
+#if XCP_DAQ_ENABLE_SEQLOCK == XCP_ON
+/** @brief Sample an event channel through a snapshot guarded by `lock`.
+ *
+ *  Takes effect with the next start of DAQ lists; pass NULL to sample directly.
+ *
+ * @param[in] eventChannelNumber
+ * @param[in] lock  Must be updated with @ref XcpDaq_SeqLockWriteBegin / @ref XcpDaq_SeqLockWriteEnd.
+ */
+void XcpDaq_SetEventSeqLock(uint16_t eventChannelNumber, XcpDaq_SeqLockType * lock)
+{
+    if (eventChannelNumber >= UINT16(XCP_DAQ_MAX_EVENT_CHANNEL)) {
+        return;
+    }
+    XcpDaq_EventSeqLocks[eventChannelNumber] = lock;
+}
+
+/** @brief Start updating variables guarded by `lock`; never blocks. Only one writer per lock.
+ */
+void XcpDaq_SeqLockWriteBegin(XcpDaq_SeqLockType * lock)
+{
+    uint32_t sequence = atomic_load_explicit(&lock->sequence, memory_order_relaxed);
+
+    atomic_store_explicit(&lock->sequence, sequence + UINT32(1), memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+}
+
+/** @brief Finish updating variables guarded by `lock`.
+ */
+void XcpDaq_SeqLockWriteEnd(XcpDaq_SeqLockType * lock)
+{
+    uint32_t sequence = atomic_load_explicit(&lock->sequence, memory_order_relaxed);
+
+    atomic_store_explicit(&lock->sequence, sequence + UINT32(1), memory_order_release);
+}
+
+/** @brief Get the number of events not sampled, because no consistent snapshot could be taken
+ *  within XCP_DAQ_SEQLOCK_MAX_RETRIES attempts.
+ *
+ * @param[in] eventChannelNumber
+ */
+uint32_t XcpDaq_GetSeqLockSkips(uint16_t eventChannelNumber)
+{
+    if (eventChannelNumber >= UINT16(XCP_DAQ_MAX_EVENT_CHANNEL)) {
+        return UINT32(0);
+    }
+    return XCP_DAQ_QUEUE_LOAD_RELAXED(XcpDaq_SeqLockSkips[eventChannelNumber]);
+}
+
+/** @brief Copy the measurement variables of the due lists of an event channel while no write is in progress.
+ */
+XCP_STATIC bool XcpDaq_TakeSnapshot(XcpDaq_GatherPlanType * plan, XcpDaq_GatherEventType const * event, bool const * due)
+{
+    XcpDaq_GatherListType const * list = XCP_NULL;
+    XcpDaq_GatherOdtType const * odt = XCP_NULL;
+    XcpDaq_GatherEntryType const * entry = XCP_NULL;
+    XcpDaq_GatherEntryType const * lastEntry = XCP_NULL;
+    uint32_t sequence = UINT32(0);
+    uint16_t listIdx = UINT16(0);
+    uint16_t odtIdx = UINT16(0);
+    uint16_t retry = UINT16(0);
+
+    for (retry = UINT16(0); retry < UINT16(XCP_DAQ_SEQLOCK_MAX_RETRIES); ++retry) {
+        sequence = atomic_load_explicit(&event->lock->sequence, memory_order_acquire);
+        if ((sequence & UINT32(1)) == UINT32(1)) {
+            continue;   /* Write in progress. */
+        }
+        for (listIdx = event->firstList; listIdx < (event->firstList + event->numLists); ++listIdx) {
+            list = &plan->lists[listIdx];
+            if (!due[listIdx - event->firstList]) {
+                continue;
+            }
+#if XCP_ENABLE_STIM == XCP_ON
+            if (list->stim != XCP_NULL) {
+                continue;
+            }
+#endif /* XCP_ENABLE_STIM */
+            for (odtIdx = list->firstOdt; odtIdx < (list->firstOdt + list->numOdts); ++odtIdx) {
+                odt = &plan->odts[odtIdx];
+                entry = &plan->entries[odt->firstEntry];
+                lastEntry = entry + odt->numEntries;
+                for (; entry < lastEntry; ++entry) {
+                    XcpUtl_SampleCopy(&plan->snapshotPool[odt->snapshotOffset + entry->offset], entry->address,
+                                      UINT32(entry->length)
+                    );
+                }
+            }
+        }
+        atomic_thread_fence(memory_order_acquire);
+        if (atomic_load_explicit(&event->lock->sequence, memory_order_relaxed) == sequence) {
+            return (bool)XCP_TRUE;
+        }
+    }
+    return (bool)XCP_FALSE;
+}
+#endif /* XCP_DAQ_ENABLE_SEQLOCK */
+
+#if XCP_ENABLE_STIM == XCP_ON
+/** @brief Store an incoming STIM DTO; a data set is complete with the last ODT of its list.
+ *
+ *  Called from the transport layer context, i.e. the only writer of the `back` slots.
+ *  DTOs of unknown PIDs or shorter than their ODT are dropped.
+ *
+ * @param[in] data  DTO, starting with the PID.
+ * @param[in] len
+ */
+void XcpDaq_ReceiveStim(uint8_t const * data, uint16_t len)
+{
+    Xcp_StateType const * state = XCP_NULL;
+    XcpDaq_GatherPlanType * plan = XCP_NULL;
+    XcpDaq_StimBufferType * stim = XCP_NULL;
+    XcpDaq_GatherListType const * list = XCP_NULL;
+    XcpDaq_GatherOdtType const * odt = XCP_NULL;
+    uint16_t odtIdx = UINT16(0);
+    uint8_t idx = UINT8(0);
+
+    state = Xcp_GetState();
+    if ((state->daqProcessor.state != XCP_DAQ_STATE_RUNNING) || (len == UINT16(0))) {
+        return;
+    }
+    plan = XcpDaq_EnterPlan(XCP_DAQ_PLAN_USER_STIM);
+    for (idx = UINT8(0); idx < plan->stimListCount; ++idx) {
+        stim = &plan->stimBuffers[idx];
+        list = &plan->lists[stim->gatherList];
+        for (odtIdx = list->firstOdt; odtIdx < (list->firstOdt + list->numOdts); ++odtIdx) {
+            odt = &plan->odts[odtIdx];
+            if (odt->pid != data[0]) {
+                continue;
+            }
+            if (len >= odt->length) {
+                XcpUtl_MemCopy(&plan->stimPool[stim->offset + (UINT16(stim->back) * stim->size) + odt->stimOffset],
+                               data, UINT32(odt->length)
+                );
+                if (odtIdx == (list->firstOdt + list->numOdts - UINT16(1))) {
+                    stim->received[stim->back] = XcpHw_GetTimerCounter();
+                    stim->back = XcpDaq_ExchangeStimSlot(stim, UINT8(stim->back | XCP_DAQ_STIM_SLOT_FRESH)) & XCP_DAQ_STIM_SLOT_MASK;
+                }
+            }
+            XcpDaq_LeavePlan(XCP_DAQ_PLAN_USER_STIM);
+            return;
+        }
+    }
+    XcpDaq_LeavePlan(XCP_DAQ_PLAN_USER_STIM);
+}
+
+/** @brief Get the delay between reception and application of the data sets of a running STIM list.
+ *
+ * @param[in] daqListNumber
+ * @param[out] latency  In units of XcpHw_GetTimerCounter().
+ * @return  XCP_FALSE if the list isn't a started STIM list, or the plans are just being changed.
+ */
+bool XcpDaq_GetStimLatency(XcpDaq_ListIntegerType daqListNumber, XcpDaq_StimLatencyType * latency)
+{
+    XcpDaq_GatherPlanType const * plan = XCP_NULL;
+    XcpDaq_StimBufferType const * stim = XCP_NULL;
+    uint8_t idx = UINT8(0);
+    bool result = (bool)XCP_FALSE;
+
+    if (!XcpDaq_LockPlans()) {
+        return (bool)XCP_FALSE;
+    }
+#if XCP_DAQ_ENABLE_LOCK_FREE_DTO_QUEUE == XCP_ON
+    plan = &XcpDaq_GatherPlans[atomic_load_explicit(&XcpDaq_ActivePlan, memory_order_relaxed)];
+#else
+    plan = &XcpDaq_GatherPlans[XcpDaq_ActivePlan];
+#endif /* XCP_DAQ_ENABLE_LOCK_FREE_DTO_QUEUE */
+    for (idx = UINT8(0); idx < plan->stimListCount; ++idx) {
+        stim = &plan->stimBuffers[idx];
+        if (plan->lists[stim->gatherList].daqListNumber == daqListNumber) {
+            *latency = stim->latency;
+            result = (bool)XCP_TRUE;
+            break;
+        }
+    }
+    XcpDaq_ReleasePlan();
+    return result;
+}
+
+/** @brief Write the latest complete data set of a STIM list to its ODT entries.
+ *
+ *  Runs in the event channel context; takes neither locks nor waits for the receiver.
+ */
+XCP_STATIC void XcpDaq_ApplyStim(XcpDaq_GatherPlanType const * plan, XcpDaq_GatherListType const * list, uint32_t timestamp)
+{
+    XcpDaq_StimBufferType * stim = list->stim;
+    XcpDaq_GatherOdtType const * odt = XCP_NULL;
+    XcpDaq_GatherEntryType const * entry = XCP_NULL;
+    XcpDaq_GatherEntryType const * lastEntry = XCP_NULL;
+    uint8_t const * slot = XCP_NULL;
+    uint16_t odtIdx = UINT16(0);
+
+    if ((XCP_DAQ_QUEUE_LOAD_RELAXED(stim->middle) & XCP_DAQ_STIM_SLOT_FRESH) != XCP_DAQ_STIM_SLOT_FRESH) {
+        return;
+    }
+    stim->front = XcpDaq_ExchangeStimSlot(stim, stim->front) & XCP_DAQ_STIM_SLOT_MASK;
+    slot = &plan->stimPool[stim->offset + (UINT16(stim->front) * stim->size)];
+    for (odtIdx = list->firstOdt; odtIdx < (list->firstOdt + list->numOdts); ++odtIdx) {
+        odt = &plan->odts[odtIdx];
+        entry = &plan->entries[odt->firstEntry];
+        lastEntry = entry + odt->numEntries;
+        for (; entry < lastEntry; ++entry) {
+            XcpUtl_MemCopy(entry->address, &slot[odt->stimOffset + entry->offset], UINT32(entry->length));
+        }
+    }
+    stim->latency.last = timestamp - stim->received[stim->front];
+    stim->latency.max = XCP_MAX(stim->latency.max, stim->latency.last);
+    stim->latency.applied++;
+}
+
+XCP_STATIC uint8_t XcpDaq_ExchangeStimSlot(XcpDaq_StimBufferType * stim, uint8_t slot)
+{
+#if XCP_DAQ_ENABLE_LOCK_FREE_DTO_QUEUE == XCP_ON
+    return atomic_exchange_explicit(&stim->middle, slot, memory_order_acq_rel);
+#else
+    uint8_t result = UINT8(0);
+
+    XCP_STIM_ENTER_CRITICAL();
+    result = stim->middle;
+    stim->middle = slot;
+    XCP_STIM_LEAVE_CRITICAL();
+    return result;
+#endif /* XCP_DAQ_ENABLE_LOCK_FREE_DTO_QUEUE */
+}
+#endif /* XCP_ENABLE_STIM */
+
+#if XCP_DAQ_OVERLOAD_INDICATION == XCP_DAQ_OVERLOAD_INDICATION_EVENT
+/** @brief Send an EV_DAQ_OVERLOAD event packet if DTOs were lost since the last call.
+ *
+ *  Runs in the transmit context; producers only bump their queue's overflow counter.
+ *  The packet goes the way of the DTOs, so it doesn't race command responses for Xcp_PduOut.
+ */
+XCP_STATIC void XcpDaq_IndicateOverload(void)
+{
+    XcpDaq_MessageType msg = {0};
+    uint32_t overruns = UINT32(0);
+    uint16_t idx = UINT16(0);
+
+    for (idx = UINT16(0); idx < UINT16(XCP_DAQ_MAX_EVENT_CHANNEL); ++idx) {
+        overruns += XcpDaq_GetEventOverruns(idx);
+    }
+    if (overruns != XcpDaq_OverrunsIndicated) {
+        XcpDaq_OverrunsIndicated = overruns;
+        XcpDaq_OverloadEvent[XCP_TRANSPORT_LAYER_BUFFER_OFFSET] = XCP_PID_EV;
+        XcpDaq_OverloadEvent[XCP_TRANSPORT_LAYER_BUFFER_OFFSET + 1] = XCP_EV_DAQ_OVERLOAD;
+        msg.dlc = UINT8(2);
+        msg.data = &XcpDaq_OverloadEvent[XCP_TRANSPORT_LAYER_BUFFER_OFFSET];
+        Xcp_SendDto(&msg);
+    }
+}
+#endif /* XCP_DAQ_OVERLOAD_INDICATION */
+
+/** @brief Make a reserved DTO visible to the transmit context, without waking it up.
+ *
+ */
+XCP_STATIC void XcpDaq_PublishMessage(uint16_t eventChannelNumber, uint8_t priority, uint8_t dlc)
+{
+    XcpDaq_DtoQueueType * queue = &XcpDaq_DtoQueues[XCP_DAQ_PRIORITY_CLASS(priority)][eventChannelNumber];
+
+    queue->buffer[queue->reserved & XCP_DAQ_DTO_BUFFER_MASK] = dlc;
+    XCP_DAQ_QUEUE_ENTER_CRITICAL();
+    XCP_DAQ_QUEUE_STORE_RELEASE(queue->state.back, XCP_DAQ_DTO_INDEX(queue->reserved + XCP_DAQ_RECORD_SIZE(dlc)));
+    XCP_DAQ_QUEUE_LEAVE_CRITICAL();
+}
+
+#if XCP_DAQ_ENABLE_TRANSMIT_TASK == XCP_ON
+/** @brief Check if any DTO queue holds messages; doesn't touch the transmit schedule.
+ *
+ */
+XCP_STATIC bool XcpDaq_MessagesPending(void)
+{
+    XcpDaq_DtoQueueType const * queue = XCP_NULL;
+    uint16_t priorityClass = UINT16(0);
+    uint16_t idx = UINT16(0);
+    bool pending = (bool)XCP_FALSE;
+
+    for (priorityClass = UINT16(0); (priorityClass < UINT16(XCP_DAQ_PRIORITY_CLASSES)) && !pending; ++priorityClass) {
+        for (idx = UINT16(0); (idx < UINT16(XCP_DAQ_MAX_EVENT_CHANNEL)) && !pending; ++idx) {
+            queue = &XcpDaq_DtoQueues[priorityClass][idx];
+            XCP_DAQ_QUEUE_ENTER_CRITICAL();
+            pending = (XCP_DAQ_QUEUE_LOAD_RELAXED(queue->state.front) != XCP_DAQ_QUEUE_LOAD_ACQUIRE(queue->state.back));
+            XCP_DAQ_QUEUE_LEAVE_CRITICAL();
+        }
+    }
+    return pending;
+}
+
+/** @brief Set or clear the waiting flag of the transmit task.
+ *
+ * @return  Previous state of the flag.
+ */
+XCP_STATIC bool XcpDaq_ExchangeTransmitterWaiting(bool waiting)
+{
+    bool previous = (bool)XCP_FALSE;
+
+#if XCP_DAQ_ENABLE_LOCK_FREE_DTO_QUEUE == XCP_ON
+    previous = atomic_exchange_explicit(&XcpDaq_TransmitterWaiting, waiting, memory_order_seq_cst);
+#else
+    XCP_DAQ_ENTER_CRITICAL();
+    previous = XcpDaq_TransmitterWaiting;
+    XcpDaq_TransmitterWaiting = waiting;
+    XCP_DAQ_LEAVE_CRITICAL();
+#endif /* XCP_DAQ_ENABLE_LOCK_FREE_DTO_QUEUE */
+    return previous;
+}
+
+/** @brief Wake the transmit task up if it's blocked.
+ *
+ *  Must follow the publication of DTOs; the fence pairs with the one in @ref XcpDaq_WaitForMessages:
+ *  either the producer sees the waiting flag or the transmit task sees the new DTOs.
+ */
+XCP_STATIC void XcpDaq_NotifyTransmitter(void)
+{
+#if XCP_DAQ_ENABLE_LOCK_FREE_DTO_QUEUE == XCP_ON
+    atomic_thread_fence(memory_order_seq_cst);
+    if (!atomic_load_explicit(&XcpDaq_TransmitterWaiting, memory_order_relaxed)) {
+        return; /* Fast path: transmit task is running. */
+    }
+#endif /* XCP_DAQ_ENABLE_LOCK_FREE_DTO_QUEUE */
+    if (XcpDaq_ExchangeTransmitterWaiting((bool)XCP_FALSE)) {
+        XcpHw_SignalTransmitRequest();
+    }
+}
+
+/** @brief Block the calling (transmit) context until DTOs are queued.
+ *
+ *  Returns immediately if DTOs are already waiting. Must only be called from the
+ *  transmit context.
+ */
+void XcpDaq_WaitForMessages(void)
+{
+    (void)XcpDaq_ExchangeTransmitterWaiting((bool)XCP_TRUE);
+#if XCP_DAQ_ENABLE_LOCK_FREE_DTO_QUEUE == XCP_ON
+    atomic_thread_fence(memory_order_seq_cst);
+#endif /* XCP_DAQ_ENABLE_LOCK_FREE_DTO_QUEUE */
+    if (XcpDaq_MessagesPending()) {
+        if (XcpDaq_ExchangeTransmitterWaiting((bool)XCP_FALSE)) {
+            return;
+        }
+        /* A producer cleared the flag in the meantime, consume its wake-up. */
+    }
+    XcpHw_WaitTransmitRequest();
+}
+
+/** @brief Body of a dedicated DTO transmit task.
+ *
+ *  Sleeps while the DTO queues are empty, then hands everything queued to the
+ *  transport layer in one batch; call it in an endless loop.
+ */
+void XcpDaq_TransmitMainFunction(void)
+{
+    XcpDaq_WaitForMessages();
+    XcpDaq_MainFunction();
+}
+#endif /* XCP_DAQ_ENABLE_TRANSMIT_TASK */
+
+/** @brief Get the oldest message of a single event channel queue.
+ *
+ * @param[in] queue
+ * @param[out] msg
+ *
+ */
+XCP_STATIC bool XcpDaq_PeekQueue(XcpDaq_DtoQueueType * queue, XcpDaq_MessageType * msg)
+{
+    XCP_DAQ_DTO_INDEX_TYPE front = XCP_DAQ_DTO_INDEX(0);
+    XCP_DAQ_DTO_INDEX_TYPE back = XCP_DAQ_DTO_INDEX(0);
+    XCP_DAQ_DTO_INDEX_TYPE offset = XCP_DAQ_DTO_INDEX(0);
+
+    XCP_DAQ_QUEUE_ENTER_CRITICAL();
+    front = XCP_DAQ_QUEUE_LOAD_RELAXED(queue->state.front);
+    back = XCP_DAQ_QUEUE_LOAD_ACQUIRE(queue->state.back);
+    if ((front != back) && (queue->buffer[front & XCP_DAQ_DTO_BUFFER_MASK] == XCP_DAQ_RECORD_WRAP)) {
+        front += XCP_DAQ_DTO_INDEX(XCP_DAQ_DTO_BUFFER_SIZE) - (front & XCP_DAQ_DTO_BUFFER_MASK);
+        XCP_DAQ_QUEUE_STORE_RELEASE(queue->state.front, front);
+    }
+    XCP_DAQ_QUEUE_LEAVE_CRITICAL();
+    if (front == back) {
+        return (bool)XCP_FALSE;
+    }
+    offset = front & XCP_DAQ_DTO_BUFFER_MASK;
+    msg->dlc = queue->buffer[offset];
+    msg->data = &queue->buffer[offset + UINT32(1) + UINT32(XCP_TRANSPORT_LAYER_BUFFER_OFFSET)];
+    return (bool)XCP_TRUE;
+}
 
 /** @brief Copies bytes from a source memory area to a destination memory area,
  *   where both areas may not overlap.
@@ -723,7 +2353,8 @@ void XcpDaq_Info(void)
     }
     printf("\n");
 #if XCP_DAQ_ENABLE_DYNAMIC_LISTS == XCP_ON
-    printf("Allocated DAQ entities: %d of %d\n", XcpDaq_EntityCount, XCP_DAQ_MAX_DYNAMIC_ENTITIES);
+    printf("Allocated DAQ entities: %u lists, %u ODTs, %u ODT entries -- %u of %u bytes\n",
+           XcpDaq_ListCount, XcpDaq_OdtCount, XcpDaq_OdtEntryCount, XcpDaq_ArenaUsed, XCP_DAQ_DYNAMIC_MEMORY_SIZE);
 #endif /* XCP_DAQ_ENABLE_DYNAMIC_LISTS */
 
 #else
@@ -740,6 +2371,14 @@ void XcpDaq_GetProperties(uint8_t * properties)
 #if XCP_DAQ_ENABLE_PRESCALER == XCP_ON
     *properties |= XCP_DAQ_PROP_PRESCALER_SUPPORTED;
 #endif /*XCP_DAQ_ENABLE_PRESCALER */
+#if XCP_DAQ_OVERLOAD_INDICATION == XCP_DAQ_OVERLOAD_INDICATION_PID
+    *properties |= XCP_DAQ_PROP_OVERLOAD_MSB;
+#elif XCP_DAQ_OVERLOAD_INDICATION == XCP_DAQ_OVERLOAD_INDICATION_EVENT
+    *properties |= XCP_DAQ_PROP_OVERLOAD_EVENT;
+#endif /* XCP_DAQ_OVERLOAD_INDICATION */
+#if XCP_DAQ_ENABLE_RESUME == XCP_ON
+    *properties |= XCP_DAQ_PROP_RESUME_SUPPORTED;
+#endif /* XCP_DAQ_ENABLE_RESUME */
 
 #if (XCP_DAQ_CONFIG_TYPE == XCP_DAQ_CONFIG_TYPE_NONE) || (XCP_DAQ_CONFIG_TYPE == XCP_DAQ_CONFIG_TYPE_STATIC)
     *properties |= UINT8(XCP_DAQ_CONFIG_TYPE_STATIC);
@@ -761,22 +2400,81 @@ void XcpDaq_SetProcessorState(XcpDaq_ProcessorStateType state)
 }
 
 
-void XcpDaq_StartSelectedLists(void)
+Xcp_ReturnType XcpDaq_StartSelectedLists(void)
 {
+    /* Stopped lists may still be sampled through the plan before the current one. */
+    XcpDaq_GatherPlanType * plan = XcpDaq_AcquireInactivePlan();
+
+    if (plan == XCP_NULL) {
+        return ERR_CMD_BUSY;
+    }
     XcpDaq_StartStopLists(DAQ_LIST_TRANSITION_START);
+    return XcpDaq_PublishGatherPlan(plan) ? ERR_SUCCESS : ERR_MEMORY_OVERFLOW;
 }
 
 
-void XcpDaq_StopSelectedLists(void)
+Xcp_ReturnType XcpDaq_StopSelectedLists(void)
 {
+    XcpDaq_GatherPlanType * plan = XcpDaq_AcquireInactivePlan();
+
+    if (plan == XCP_NULL) {
+        return ERR_CMD_BUSY;
+    }
     XcpDaq_StartStopLists(DAQ_LIST_TRANSITION_STOP);
+    (void)XcpDaq_PublishGatherPlan(plan);  /* Fewer lists always fit. */
+    return ERR_SUCCESS;
 }
 
 
-void XcpDaq_StopAllLists(void)
+Xcp_ReturnType XcpDaq_StopAllLists(void)
 {
-    XcpDaq_StartStopLists(DAQ_LIST_TRANSITION_STOP);
+    return XcpDaq_StopSelectedLists();
+}
+
+#if XCP_ENABLE_ADDRESS_MAPPER == XCP_ON
+/** @brief Re-resolve the cached host pointers of the running lists after the mapping of an address range changed.
+ *
+ *  Gather plans resolve their sources through Xcp_HookFunction_AddressMapper() once at start,
+ *  so the application calls this on a page switch. If any entry overlaps the range, the whole plan is
+ *  compiled anew -- not just the overlapping entries: coalesced runs and single-load entries depend on
+ *  the mapped addresses, a new mapping may split a run and move the entries behind it. The plan is built
+ *  outside the DAQ critical section and published as a whole; events in progress finish with the previous pointers.
+ *
+ * @param[in] address   Unmapped start of the range.
+ * @param[in] length
+ * @return XCP_FALSE if the mapper rejected an entry or the plans are busy, s. XcpDaq_AcquireInactivePlan();
+ *         the lists keep sampling the previous pointers.
+ */
+bool XcpDaq_RemapAddressRange(uint32_t address, uint32_t length)
+{
+    XcpDaq_GatherPlanType const * active = XCP_NULL;
+    XcpDaq_GatherPlanType * plan = XCP_NULL;
+    Xcp_MtaType const * source = XCP_NULL;
+    uint16_t idx = UINT16(0);
+    bool result = (bool)XCP_TRUE;
+
+    plan = XcpDaq_AcquireInactivePlan();
+    if (plan == XCP_NULL) {
+        return (bool)XCP_FALSE;
+    }
+    active = &XcpDaq_GatherPlans[UINT8(1) - UINT8(plan - &XcpDaq_GatherPlans[0])];
+    for (idx = UINT16(0); idx < active->entryCount; ++idx) {
+        source = &active->sources[idx];
+        if ((source->address < (address + length)) && (address < (source->address + active->entries[idx].length))) {
+            break;
+        }
+    }
+    if (idx == active->entryCount) {
+        XcpDaq_ReleasePlan();   /* Not affected. */
+    } else if (XcpDaq_BuildGatherPlan(plan)) {
+        XcpDaq_PublishPlan(plan);
+    } else {
+        XcpDaq_ReleasePlan();
+        result = (bool)XCP_FALSE;
+    }
+    return result;
 }
+#endif /* XCP_ENABLE_ADDRESS_MAPPER */
 
 
 /*
@@ -785,18 +2483,22 @@ void XcpDaq_StopAllLists(void)
 XCP_STATIC XcpDaq_ODTType const * XcpDaq_GetOdt(XcpDaq_ListIntegerType daqListNumber, XcpDaq_ODTIntegerType odtNumber)
 {
     XcpDaq_ListConfigurationType const * dl = XCP_NULL;
-    XcpDaq_ODTIntegerType idx = 0;
+    uint16_t idx = UINT16(0);
 
     dl = XcpDaq_GetListConfiguration(daqListNumber);
-    idx = (XcpDaq_ODTIntegerType)dl->firstOdt + odtNumber;
+    idx = UINT16(dl->firstOdt + UINT16(odtNumber));
 #if (XCP_DAQ_ENABLE_DYNAMIC_LISTS == XCP_ON) && (XCP_DAQ_ENABLE_PREDEFINED_LISTS == XCP_OFF)
     /* Dynamic DAQs only */
-    return &XcpDaq_Entities[idx].entity.odt;
+    return &XcpDaq_DynamicOdts[idx];
 #elif (XCP_DAQ_ENABLE_DYNAMIC_LISTS == XCP_OFF) && (XCP_DAQ_ENABLE_PREDEFINED_LISTS == XCP_ON)
     /* Predefined DAQs only */
     return &XcpDaq_PredefinedOdts[idx];
 #elif (XCP_DAQ_ENABLE_DYNAMIC_LISTS == XCP_ON) && (XCP_DAQ_ENABLE_PREDEFINED_LISTS == XCP_ON)
     /* Dynamic and predefined DAQs */
+    if (daqListNumber < XcpDaq_PredefinedListCount) {
+        return &XcpDaq_PredefinedOdts[idx];
+    }
+    return &XcpDaq_DynamicOdts[idx];
 #endif
 }
 
@@ -809,7 +2511,15 @@ XCP_STATIC void XcpDaq_StartStopLists(XcpDaq_ListTransitionType transition)
         entry = XcpDaq_GetListState(idx);
         if ((entry->mode & XCP_DAQ_LIST_MODE_SELECTED) == XCP_DAQ_LIST_MODE_SELECTED) {
             if (transition == DAQ_LIST_TRANSITION_START) {
+#if XCP_DAQ_ENABLE_PRESCALER == XCP_ON
+                /* Lists already running keep their prescaler phase. */
+                if ((entry->mode & XCP_DAQ_LIST_MODE_STARTED) != XCP_DAQ_LIST_MODE_STARTED) {
+                    entry->counter = UINT8(0);
+                }
+#endif /* XCP_DAQ_ENABLE_PRESCALER */
                 entry->mode |= XCP_DAQ_LIST_MODE_STARTED;
+                XCP_DAQ_QUEUE_STORE_RELAXED(entry->overload, UINT8(0));
+                XCP_DAQ_QUEUE_STORE_RELAXED(entry->overruns, UINT32(0));
                 /* printf("Started DAQ list #%u\n", idx); */
             } else if (transition == DAQ_LIST_TRANSITION_STOP) {
                 entry->mode &= UINT8(~XCP_DAQ_LIST_MODE_STARTED);
@@ -826,59 +2536,432 @@ XCP_STATIC void XcpDaq_StartStopLists(XcpDaq_ListTransitionType transition)
     }
 }
 
+/** @brief Compile started DAQ lists into flat gather plans, grouped by event channel, and publish them.
+ *
+ *  The plan is taken by @ref XcpDaq_AcquireInactivePlan before the lists change.
+ *
+ *  @return XCP_FALSE if the plans don't fit into XCP_DAQ_GATHER_PLAN_SIZE (or the list and ODT limits) or
+ *          an ODT exceeds XCP_MAX_DTO; no list is sampled in this case.
+ */
+XCP_STATIC bool XcpDaq_PublishGatherPlan(XcpDaq_GatherPlanType * plan)
+{
+    bool result = XcpDaq_BuildGatherPlan(plan);
+
+    if (!result) {
+        XcpDaq_ResetGatherPlan(plan);
+    }
+    XcpDaq_PublishPlan(plan);
+    return result;
+}
+
+/** @brief Compile started DAQ lists into an acquired, unpublished plan; producers keep sampling the active one.
+ */
+XCP_STATIC bool XcpDaq_BuildGatherPlan(XcpDaq_GatherPlanType * plan)
+{
+    XcpDaq_GatherEventType * event = XCP_NULL;
+    XcpDaq_ListIntegerType daqListNumber = (XcpDaq_ListIntegerType)0;
+    uint16_t eventIdx = UINT16(0);
+    uint8_t idx = UINT8(0);
+
+    for (eventIdx = UINT16(0); eventIdx < UINT16(XCP_DAQ_MAX_EVENT_CHANNEL); ++eventIdx) {
+        event = &plan->events[eventIdx];
+        event->firstList = plan->listCount;
+        for (idx = UINT8(0); idx < XcpDaq_ListCountForEvent[eventIdx]; ++idx) {
+            daqListNumber = XcpDaq_ListsForEvent[eventIdx][idx];
+            if (daqListNumber >= XcpDaq_GetListCount()) {
+                continue;
+            }
+            if ((XcpDaq_GetListState(daqListNumber)->mode & XCP_DAQ_LIST_MODE_STARTED) != XCP_DAQ_LIST_MODE_STARTED) {
+                continue;
+            }
+            if (!XcpDaq_CompileGatherList(plan, daqListNumber)) {
+                return (bool)XCP_FALSE;
+            }
+        }
+        event->numLists = plan->listCount - event->firstList;
+#if XCP_DAQ_ENABLE_SEQLOCK == XCP_ON
+        if ((XcpDaq_EventSeqLocks[eventIdx] != XCP_NULL) && (event->numLists > UINT16(0))) {
+            if (!XcpDaq_CompileSnapshot(plan, event)) {
+                return (bool)XCP_FALSE;
+            }
+            event->lock = XcpDaq_EventSeqLocks[eventIdx];
+        }
+#endif /* XCP_DAQ_ENABLE_SEQLOCK */
+    }
+    return (bool)XCP_TRUE;
+}
+
+XCP_STATIC bool XcpDaq_CompileGatherList(XcpDaq_GatherPlanType * plan, XcpDaq_ListIntegerType daqListNumber)
+{
+    XcpDaq_ListConfigurationType const * listConf = XCP_NULL;
+    XcpDaq_ODTType const * odt = XCP_NULL;
+    XcpDaq_ODTEntryType const * odtEntry = XCP_NULL;
+    XcpDaq_GatherListType * gatherList = XCP_NULL;
+    XcpDaq_GatherOdtType * gatherOdt = XCP_NULL;
+    XcpDaq_GatherEntryType * gatherEntry = XCP_NULL;
+    XcpDaq_ODTIntegerType firstPid = (XcpDaq_ODTIntegerType)0;
+    XcpDaq_ODTIntegerType odtIdx = (XcpDaq_ODTIntegerType)0;
+    XcpDaq_ODTEntryIntegerType odtEntryIdx = (XcpDaq_ODTEntryIntegerType)0;
+    uint8_t mode = UINT8(0);
+    uint16_t offset = UINT16(0);
+    uint16_t stimOffset = UINT16(0);
+    uint8_t * address = XCP_NULL;
+    bool singleLoad = (bool)XCP_FALSE;
+    bool previousSingleLoad = (bool)XCP_FALSE;
+#if XCP_DAQ_REMOTE_SAMPLING == XCP_ON
+    uint8_t remote = UINT8(0);
+#endif /* XCP_DAQ_REMOTE_SAMPLING */
+#if XCP_ENABLE_ADDRESS_MAPPER == XCP_ON
+    Xcp_MtaType source = {0};
+    Xcp_MtaType const * previous = XCP_NULL;
+#endif /* XCP_ENABLE_ADDRESS_MAPPER */
+#if XCP_DAQ_ENABLE_PREDEFINED_SAMPLERS == XCP_ON
+    XcpDaq_OdtSamplerType const * sampler = XCP_NULL;
+    uint16_t headerLength = UINT16(0);
+#endif /* XCP_DAQ_ENABLE_PREDEFINED_SAMPLERS */
+
+    if (plan->listCount >= UINT16(XCP_DAQ_GATHER_PLAN_LISTS)) {
+        return (bool)XCP_FALSE;
+    }
+    (void)XcpDaq_GetFirstPid(daqListNumber, &firstPid);
+    listConf = XcpDaq_GetListConfiguration(daqListNumber);
+    mode = XcpDaq_GetListState(daqListNumber)->mode;
+
+    gatherList = &plan->lists[plan->listCount];
+    gatherList->daqListNumber = daqListNumber;
+    gatherList->firstOdt = plan->odtCount;
+    gatherList->numOdts = UINT16(0);
+#if XCP_DAQ_ENABLE_PRIORITIZATION == XCP_ON
+    gatherList->priority = XcpDaq_GetListState(daqListNumber)->priority;
+#else
+    gatherList->priority = UINT8(0);
+#endif /* XCP_DAQ_ENABLE_PRIORITIZATION */
+    gatherList->state = XcpDaq_GetListState(daqListNumber);
+#if XCP_ENABLE_STIM == XCP_ON
+    gatherList->stim = (XcpDaq_StimBufferType *)XCP_NULL;
+    if (((mode & XCP_DAQ_LIST_MODE_DIRECTION) == XCP_DAQ_LIST_MODE_DIRECTION) &&
+        ((mode & XCP_DAQ_LIST_MODE_PID_OFF) == XCP_DAQ_LIST_MODE_PID_OFF)) {
+        return (bool)XCP_FALSE;     /* Incoming STIM DTOs are identified by PID. */
+    }
+#endif /* XCP_ENABLE_STIM */
+
+    for (odtIdx = (XcpDaq_ODTIntegerType)0; odtIdx < listConf->numOdts; ++odtIdx) {
+        odt = XcpDaq_GetOdt(daqListNumber, odtIdx);
+        if (odt->numOdtEntries == (XcpDaq_ODTEntryIntegerType)0) {
+            continue;
+        }
+        if (plan->odtCount >= UINT16(XCP_DAQ_GATHER_PLAN_ODTS)) {
+            return (bool)XCP_FALSE;
+        }
+        gatherOdt = &plan->odts[plan->odtCount];
+        gatherOdt->pid = UINT8(firstPid + odtIdx);
+        gatherOdt->header = UINT8(0);
+        gatherOdt->firstEntry = plan->entryCount;
+        gatherOdt->numEntries = UINT16(0);
+#if XCP_ENABLE_STIM == XCP_ON
+        gatherOdt->stimOffset = stimOffset;
+#endif /* XCP_ENABLE_STIM */
+        offset = UINT16(0);
+        if ((mode & XCP_DAQ_LIST_MODE_PID_OFF) != XCP_DAQ_LIST_MODE_PID_OFF) {
+            gatherOdt->header |= XCP_DAQ_GATHER_HEADER_PID;
+            offset += UINT16(1);
+        }
+        if ((odtIdx == (XcpDaq_ODTIntegerType)0) && ((mode & XCP_DAQ_LIST_MODE_TIMESTAMP) == XCP_DAQ_LIST_MODE_TIMESTAMP)) {
+            gatherOdt->header |= XCP_DAQ_GATHER_HEADER_TIMESTAMP;
+            offset += UINT16(XCP_DAQ_TIMESTAMP_SIZE);
+        }
+#if XCP_DAQ_ENABLE_PREDEFINED_SAMPLERS == XCP_ON
+        headerLength = offset;
+#endif /* XCP_DAQ_ENABLE_PREDEFINED_SAMPLERS */
+        for (odtEntryIdx = (XcpDaq_ODTEntryIntegerType)0; odtEntryIdx < odt->numOdtEntries; ++odtEntryIdx) {
+            odtEntry = XcpDaq_GetOdtEntry(daqListNumber, odtIdx, odtEntryIdx);
+            if (odtEntry->length == UINT32(0)) {
+                continue;
+            }
+            if ((offset + odtEntry->length) > UINT32(XCP_MAX_DTO)) {
+                return (bool)XCP_FALSE;
+            }
+#if XCP_ENABLE_ADDRESS_MAPPER == XCP_ON
+            source.address = odtEntry->mta.address;
+#if XCP_DAQ_ENABLE_ADDR_EXT == XCP_ON
+            source.ext = odtEntry->mta.ext;
+#endif /* XCP_DAQ_ENABLE_ADDR_EXT */
+            if (!XcpDaq_MapAddress(&source, &address)) {
+                return (bool)XCP_FALSE;
+            }
+#else
+            address = (uint8_t *)(uintptr_t)odtEntry->mta.address;
+#endif /* XCP_ENABLE_ADDRESS_MAPPER */
+#if XCP_DAQ_REMOTE_SAMPLING == XCP_ON
+            remote = (odtEntry->mta.ext == UINT8(XCP_REMOTE_MEMORY_ADDRESS_EXTENSION)) ? XCP_DAQ_GATHER_HEADER_REMOTE : UINT8(0);
+            if (gatherOdt->numEntries == UINT16(0)) {
+                gatherOdt->header |= remote;
+            } else if ((gatherOdt->header & XCP_DAQ_GATHER_HEADER_REMOTE) != remote) {
+                return (bool)XCP_FALSE;     /* An ODT is sampled either locally or remotely. */
+            }
+            if ((remote != UINT8(0)) && ((mode & XCP_DAQ_LIST_MODE_DIRECTION) == XCP_DAQ_LIST_MODE_DIRECTION)) {
+                return (bool)XCP_FALSE;     /* No remote STIM. */
+            }
+#endif /* XCP_DAQ_REMOTE_SAMPLING */
+            singleLoad = XCP_DAQ_IS_SINGLE_LOAD(address, odtEntry->length);
+#if XCP_DAQ_REMOTE_SAMPLING == XCP_ON
+            if (remote != UINT8(0)) {
+                singleLoad = (bool)XCP_FALSE;   /* Read by the HAL, not by loads of ours. */
+            }
+#endif /* XCP_DAQ_REMOTE_SAMPLING */
+            /* Merging a member into a longer run would tear it, s. XCP_DAQ_IS_SINGLE_LOAD. */
+            if ((gatherOdt->numEntries > UINT16(0)) && !singleLoad && !previousSingleLoad) {
+                /* Entries are packed back to back, so a source continuing the previous one extends its copy. */
+                gatherEntry = &plan->entries[plan->entryCount - UINT16(1)];
+#if XCP_ENABLE_ADDRESS_MAPPER == XCP_ON
+                /* Remapping checks the source range of an entry, so it has to be contiguous as well. */
+                previous = &plan->sources[plan->entryCount - UINT16(1)];
+                if (((gatherEntry->address + gatherEntry->length) == address) &&
+                    (previous->ext == source.ext) && ((previous->address + gatherEntry->length) == source.address)) {
+#else
+                if ((gatherEntry->address + gatherEntry->length) == address) {
+#endif /* XCP_ENABLE_ADDRESS_MAPPER */
+                    gatherEntry->length += UINT16(odtEntry->length);
+#if XCP_DAQ_REMOTE_SAMPLING == XCP_ON
+                    plan->remoteSegments[plan->entryCount - UINT16(1)].length += odtEntry->length;
+#endif /* XCP_DAQ_REMOTE_SAMPLING */
+                    offset += UINT16(odtEntry->length);
+                    continue;
+                }
+            }
+            if (plan->entryCount >= UINT16(XCP_DAQ_GATHER_PLAN_SIZE)) {
+                return (bool)XCP_FALSE;
+            }
+            gatherEntry = &plan->entries[plan->entryCount];
+            gatherEntry->address = address;    /* Not dereferenced for remote ODTs. */
+            gatherEntry->offset = offset;
+            gatherEntry->length = UINT16(odtEntry->length);
+#if XCP_ENABLE_ADDRESS_MAPPER == XCP_ON
+            plan->sources[plan->entryCount] = source;
+#endif /* XCP_ENABLE_ADDRESS_MAPPER */
+#if XCP_DAQ_REMOTE_SAMPLING == XCP_ON
+            plan->remoteSegments[plan->entryCount].address = odtEntry->mta.address;
+            plan->remoteSegments[plan->entryCount].length = odtEntry->length;
+#endif /* XCP_DAQ_REMOTE_SAMPLING */
+            offset += UINT16(odtEntry->length);
+            gatherOdt->numEntries += UINT16(1);
+            plan->entryCount += UINT16(1);
+            previousSingleLoad = singleLoad;
+        }
+        gatherOdt->length = offset;
+#if XCP_DAQ_ENABLE_PREDEFINED_SAMPLERS == XCP_ON
+        gatherOdt->sample = (XcpDaq_SampleFunctionType)XCP_NULL;
+        if (daqListNumber < XcpDaq_PredefinedListCount) {
+            sampler = &XcpDaq_PredefinedOdtSamplers[listConf->firstOdt + UINT16(odtIdx)];
+            if (sampler->sample != XCP_NULL) {
+                if (sampler->length != (offset - headerLength)) {
+                    return (bool)XCP_FALSE;     /* Sampler doesn't match the ODT entries. */
+                }
+                gatherOdt->sample = sampler->sample;
+            }
+        }
+#endif /* XCP_DAQ_ENABLE_PREDEFINED_SAMPLERS */
+        stimOffset += offset;
+        gatherList->numOdts += UINT16(1);
+        plan->odtCount += UINT16(1);
+    }
+#if XCP_ENABLE_STIM == XCP_ON
+    if ((mode & XCP_DAQ_LIST_MODE_DIRECTION) == XCP_DAQ_LIST_MODE_DIRECTION) {
+        if (!XcpDaq_CompileStimBuffer(plan, gatherList, stimOffset)) {
+            return (bool)XCP_FALSE;
+        }
+    }
+#endif /* XCP_ENABLE_STIM */
+    plan->listCount += UINT16(1);
+    return (bool)XCP_TRUE;
+}
+
+#if XCP_ENABLE_ADDRESS_MAPPER == XCP_ON
+/** @brief Resolve the source of a gather entry to a host pointer.
+ *
+ * @return XCP_FALSE if the mapper rejects the address.
+ */
+XCP_STATIC bool XcpDaq_MapAddress(Xcp_MtaType const * source, uint8_t ** address)
+{
+    Xcp_MtaType mapped = {0};
+    Xcp_MemoryMappingResultType res = XCP_MEMORY_ADDRESS_INVALID;
 
+#if XCP_DAQ_REMOTE_SAMPLING == XCP_ON
+    if (source->ext == UINT8(XCP_REMOTE_MEMORY_ADDRESS_EXTENSION)) {
+        *address = (uint8_t *)(uintptr_t)source->address;  /* Target address, not mapped. */
+        return (bool)XCP_TRUE;
+    }
+#endif /* XCP_DAQ_REMOTE_SAMPLING */
+    mapped.address = source->address;
+    res = Xcp_HookFunction_AddressMapper(&mapped, source);
+    if (res == XCP_MEMORY_ADDRESS_INVALID) {
+        return (bool)XCP_FALSE;
+    }
+    *address = (uint8_t *)(uintptr_t)((res == XCP_MEMORY_MAPPED) ? mapped.address : source->address);
+    return (bool)XCP_TRUE;
+}
+#endif /* XCP_ENABLE_ADDRESS_MAPPER */
+
+#if XCP_DAQ_ENABLE_SEQLOCK == XCP_ON
+/** @brief Reserve snapshot space for the DTOs of a sequence locked event channel.
+ */
+XCP_STATIC bool XcpDaq_CompileSnapshot(XcpDaq_GatherPlanType * plan, XcpDaq_GatherEventType const * event)
+{
+    XcpDaq_GatherListType const * list = XCP_NULL;
+    XcpDaq_GatherOdtType * odt = XCP_NULL;
+    uint16_t listIdx = UINT16(0);
+    uint16_t odtIdx = UINT16(0);
+
+    for (listIdx = event->firstList; listIdx < (event->firstList + event->numLists); ++listIdx) {
+        list = &plan->lists[listIdx];
+#if XCP_ENABLE_STIM == XCP_ON
+        if (list->stim != XCP_NULL) {
+            continue;
+        }
+#endif /* XCP_ENABLE_STIM */
+        for (odtIdx = list->firstOdt; odtIdx < (list->firstOdt + list->numOdts); ++odtIdx) {
+            odt = &plan->odts[odtIdx];
+#if XCP_DAQ_REMOTE_SAMPLING == XCP_ON
+            if ((odt->header & XCP_DAQ_GATHER_HEADER_REMOTE) == XCP_DAQ_GATHER_HEADER_REMOTE) {
+                return (bool)XCP_FALSE;     /* The sequence lock guards local writers only. */
+            }
+#endif /* XCP_DAQ_REMOTE_SAMPLING */
+            if ((UINT32(plan->snapshotPoolUsed) + UINT32(odt->length)) > UINT32(XCP_DAQ_SNAPSHOT_BUFFER_SIZE)) {
+                return (bool)XCP_FALSE;
+            }
+            odt->snapshotOffset = plan->snapshotPoolUsed;
+            plan->snapshotPoolUsed += odt->length;
+        }
+    }
+    return (bool)XCP_TRUE;
+}
+#endif /* XCP_DAQ_ENABLE_SEQLOCK */
+
+#if XCP_ENABLE_STIM == XCP_ON
+/** @brief Reserve the data set slots of a STIM list.
+ *
+ * @param[in] gatherList
+ * @param[in] size      Sum of the DTO lengths of the list.
+ */
+XCP_STATIC bool XcpDaq_CompileStimBuffer(XcpDaq_GatherPlanType * plan, XcpDaq_GatherListType * gatherList, uint16_t size)
+{
+    XcpDaq_StimBufferType * stim = XCP_NULL;
+
+    if (plan->stimListCount >= UINT8(XCP_DAQ_MAX_STIM_LISTS)) {
+        return (bool)XCP_FALSE;
+    }
+    if ((UINT32(plan->stimPoolUsed) + (UINT32(3) * UINT32(size))) > UINT32(XCP_DAQ_STIM_BUFFER_SIZE)) {
+        return (bool)XCP_FALSE;
+    }
+    stim = &plan->stimBuffers[plan->stimListCount];
+    stim->back = UINT8(0);
+    stim->front = UINT8(2);
+    XCP_DAQ_QUEUE_STORE_RELEASE(stim->middle, UINT8(1));
+    stim->gatherList = plan->listCount;
+    stim->offset = plan->stimPoolUsed;
+    stim->size = size;
+    stim->latency.last = UINT32(0);
+    stim->latency.max = UINT32(0);
+    stim->latency.applied = UINT32(0);
+    gatherList->stim = stim;
+    plan->stimPoolUsed += UINT16(UINT16(3) * size);
+    plan->stimListCount += UINT8(1);
+    return (bool)XCP_TRUE;
+}
+#endif /* XCP_ENABLE_STIM */
+
+XCP_STATIC void XcpDaq_PutTimestamp(uint8_t * dst, uint32_t timestamp)
+{
+#if XCP_DAQ_TIMESTAMP_SIZE == XCP_DAQ_TIMESTAMP_SIZE_1
+    dst[0] = UINT8(timestamp);
+#elif XCP_DAQ_TIMESTAMP_SIZE == XCP_DAQ_TIMESTAMP_SIZE_2
+    dst[0] = XCP_LOBYTE(UINT16(timestamp));
+    dst[1] = XCP_HIBYTE(UINT16(timestamp));
+#elif XCP_DAQ_TIMESTAMP_SIZE == XCP_DAQ_TIMESTAMP_SIZE_4
+    dst[0] = UINT8(timestamp & UINT32(0xff));
+    dst[1] = UINT8((timestamp & UINT32(0xff00)) >> UINT8(8));
+    dst[2] = UINT8((timestamp & UINT32(0xff0000)) >> UINT8(16));
+    dst[3] = UINT8((timestamp & UINT32(0xff000000)) >> UINT8(24));
+#endif /* XCP_DAQ_TIMESTAMP_SIZE */
+}
+
+
+/** @brief PID of the first ODT of a DAQ list, i.e. the number of ODTs of all preceding lists.
+ *
+ *  O(1), the prefix sums are rebuilt on the first call after the configuration changed.
+ */
 bool XcpDaq_GetFirstPid(XcpDaq_ListIntegerType daqListNumber, XcpDaq_ODTIntegerType * firstPID)
 {
-    XcpDaq_ListIntegerType listIdx = 0;
-    XcpDaq_ListConfigurationType const * daqList = XCP_NULL;
     bool result = (bool)XCP_TRUE;
     XcpDaq_ODTIntegerType tmp = (XcpDaq_ODTIntegerType)0;
 
     if (daqListNumber > (XcpDaq_GetListCount() - UINT16(1))) {
         result = (bool)XCP_FALSE;
     } else {
-        for (listIdx = UINT16(0); listIdx < daqListNumber; ++listIdx) {
-            daqList = XcpDaq_GetListConfiguration(listIdx);
-            tmp += daqList->numOdts;
+        if (!XcpDaq_FirstPidsValid) {
+            XcpDaq_UpdateFirstPids();
         }
+        tmp = XcpDaq_GetListState(daqListNumber)->firstPid;
     }
     *firstPID = tmp;
     return result;
 }
 
+/** @brief Rebuild the first PIDs of all DAQ lists in one pass.
+ *
+ *
+ */
+XCP_STATIC void XcpDaq_UpdateFirstPids(void)
+{
+    XcpDaq_ListIntegerType listIdx = 0;
+    XcpDaq_ODTIntegerType sum = (XcpDaq_ODTIntegerType)0;
+
+    for (listIdx = UINT16(0); listIdx < XcpDaq_GetListCount(); ++listIdx) {
+        XcpDaq_GetListState(listIdx)->firstPid = sum;
+        sum += XcpDaq_GetListConfiguration(listIdx)->numOdts;
+    }
+    XcpDaq_FirstPidsValid = (bool)XCP_TRUE;
+}
+
 
 /*
 **  Debugging / Testing interface.
 */
 #if XCP_BUILD_TYPE == XCP_DEBUG_BUILD
 #if XCP_DAQ_ENABLE_DYNAMIC_LISTS == XCP_ON
-void XcpDaq_GetCounts(XCP_DAQ_ENTITY_TYPE * entityCount, XCP_DAQ_ENTITY_TYPE * listCount, XCP_DAQ_ENTITY_TYPE * odtCount)
+void XcpDaq_GetCounts(uint16_t * entityCount, uint16_t * listCount, uint16_t * odtCount)
 {
-    *entityCount = XcpDaq_EntityCount;
+    *entityCount = UINT16(XcpDaq_ListCount + XcpDaq_OdtCount + XcpDaq_OdtEntryCount);
     *listCount = XcpDaq_ListCount;
     *odtCount = XcpDaq_OdtCount;
 }
 
-uint16_t XcpDaq_TotalDynamicEntityCount(void)
+void XcpDaq_GetDynamicMemory(uint32_t * used, uint32_t * size)
 {
-    return UINT16(XCP_DAQ_MAX_DYNAMIC_ENTITIES);
+    *used = XcpDaq_ArenaUsed;
+    *size = UINT32(XCP_DAQ_DYNAMIC_MEMORY_SIZE);
 }
 
-XcpDaq_EntityType * XcpDaq_GetDynamicEntities(void)
+uint8_t * XcpDaq_GetDtoBuffer(uint16_t eventChannelNumber, uint8_t priority)
 {
-    return &XcpDaq_Entities[0];
+    return &XcpDaq_DtoQueues[XCP_DAQ_PRIORITY_CLASS(priority)][eventChannelNumber].buffer[0];
 }
 
-XcpDaq_EntityType * XcpDaq_GetDynamicEntity(uint16_t num)
-{
-    return &XcpDaq_Entities[num];
-}
+#endif /* XCP_DAQ_ENABLE_DYNAMIC_LISTS */
 
-uint8_t * XcpDaq_GetDtoBuffer(void)
+/* Copies of the published plan, after coalescing adjacent ODT entries. */
+uint16_t XcpDaq_GetGatherEntryCount(void)
 {
-    return &XcpDaq_DtoBuffer[0];
-}
+    uint16_t count = UINT16(0);
 
-#endif /* XCP_DAQ_ENABLE_DYNAMIC_LISTS */
+    XCP_DAQ_ENTER_CRITICAL();
+#if XCP_DAQ_ENABLE_LOCK_FREE_DTO_QUEUE == XCP_ON
+    count = XcpDaq_GatherPlans[atomic_load_explicit(&XcpDaq_ActivePlan, memory_order_relaxed)].entryCount;
+#else
+    count = XcpDaq_GatherPlans[XcpDaq_ActivePlan].entryCount;
+#endif /* XCP_DAQ_ENABLE_LOCK_FREE_DTO_QUEUE */
+    XCP_DAQ_LEAVE_CRITICAL();
+    return count;
+}
 
 #endif // XCP_BUILD_TYPE
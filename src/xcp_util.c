@@ -31,6 +31,44 @@
 #include <stdio.h>
 #endif // _MSC_VER
 
+/* Vector paths are selected at build time; the intrinsic headers require the standard integer types. */
+#if defined(C11_COMPILER)
+    #if defined(__AVX2__)
+        #define XCP_UTL_SIMD_AVX2
+        #define XCP_UTL_SIMD_SSE2
+        #include <immintrin.h>
+    #elif defined(__SSE2__) || defined(_M_X64)
+        #define XCP_UTL_SIMD_SSE2
+        #include <emmintrin.h>
+    #elif defined(__ARM_NEON)
+        #define XCP_UTL_SIMD_NEON
+        #include <arm_neon.h>
+    #endif
+#endif /* C11_COMPILER */
+
+#if defined(C11_COMPILER)
+/*
+**  Native-order views used to store a sampled word to a possibly unaligned destination;
+**  compilers fold the byte stores into a single (unaligned) store where the target allows it.
+*/
+typedef union tagXcpUtl_Word16Type {
+    uint16_t value;
+    uint8_t bytes[2];
+} XcpUtl_Word16Type;
+
+typedef union tagXcpUtl_Word32Type {
+    uint32_t value;
+    uint8_t bytes[4];
+} XcpUtl_Word32Type;
+
+typedef union tagXcpUtl_Word64Type {
+    uint64_t value;
+    uint8_t bytes[8];
+} XcpUtl_Word64Type;
+
+#define XCP_UTL_IS_ALIGNED(ptr, size)   ((((uintptr_t)(ptr)) & ((uintptr_t)(size) - (uintptr_t)1)) == (uintptr_t)0)
+#endif /* C11_COMPILER */
+
 void XcpUtl_MemCopy(/*@out@*/void * dst,/*@in@*/ void const * src, uint32_t len)
 {
     uint8_t * pd = (uint8_t *)dst;
@@ -48,6 +86,111 @@ void XcpUtl_MemCopy(/*@out@*/void * dst,/*@in@*/ void const * src, uint32_t len)
 
 }
 
+/** @brief Copy a measurement value into a DTO.
+ *
+ *  Naturally aligned 2 and 4 byte sources -- and 8 byte sources on 64-bit targets -- are read with a
+ *  single load of that width (C11 compilers, s. XCP_UTL_SINGLE_LOAD_MAX), so the sampled value is
+ *  never torn by a concurrent writer of the same width; 32-bit targets may split 8-byte loads.
+ *  longer runs are copied in vector-sized chunks where available. Such runs are coalesced only
+ *  from ODT entries that aren't sampled with a single load themselves, s. XcpDaq_CompileGatherList().
+ *
+ * @param[out] dst  Destination in the DTO, no alignment requirements.
+ * @param[in] src   Measurement source.
+ * @param[in] len   Number of bytes.
+ */
+void XcpUtl_SampleCopy(/*@out@*/void * dst,/*@in@*/ void const * src, uint32_t len)
+{
+    uint8_t * pd = (uint8_t *)dst;
+    uint8_t const * ps = (uint8_t const *)src;
+#if defined(C11_COMPILER)
+    XcpUtl_Word16Type w16;
+    XcpUtl_Word32Type w32;
+#if XCP_UTL_SINGLE_LOAD_MAX == 8
+    XcpUtl_Word64Type w64;
+#endif /* XCP_UTL_SINGLE_LOAD_MAX */
+#endif /* C11_COMPILER */
+
+    switch (len) {
+        case 1:
+            pd[0] = ps[0];
+            return;
+#if defined(C11_COMPILER)
+        case 2:
+            if (XCP_UTL_IS_ALIGNED(ps, 2)) {
+                w16.value = *(uint16_t const volatile *)ps;
+                pd[0] = w16.bytes[0];
+                pd[1] = w16.bytes[1];
+                return;
+            }
+            break;
+        case 4:
+            if (XCP_UTL_IS_ALIGNED(ps, 4)) {
+                w32.value = *(uint32_t const volatile *)ps;
+                pd[0] = w32.bytes[0];
+                pd[1] = w32.bytes[1];
+                pd[2] = w32.bytes[2];
+                pd[3] = w32.bytes[3];
+                return;
+            }
+            break;
+#if XCP_UTL_SINGLE_LOAD_MAX == 8
+        case 8:
+            if (XCP_UTL_IS_ALIGNED(ps, 8)) {
+                w64.value = *(uint64_t const volatile *)ps;
+                pd[0] = w64.bytes[0];
+                pd[1] = w64.bytes[1];
+                pd[2] = w64.bytes[2];
+                pd[3] = w64.bytes[3];
+                pd[4] = w64.bytes[4];
+                pd[5] = w64.bytes[5];
+                pd[6] = w64.bytes[6];
+                pd[7] = w64.bytes[7];
+                return;
+            }
+            break;
+#endif /* XCP_UTL_SINGLE_LOAD_MAX */
+#endif /* C11_COMPILER */
+        default:
+            break;
+    }
+
+#if defined(XCP_UTL_SIMD_AVX2)
+    while (len >= UINT32(32)) {
+        _mm256_storeu_si256((__m256i *)pd, _mm256_loadu_si256((__m256i const *)ps));
+        pd += 32;
+        ps += 32;
+        len -= UINT32(32);
+    }
+#endif /* XCP_UTL_SIMD_AVX2 */
+#if defined(XCP_UTL_SIMD_SSE2)
+    while (len >= UINT32(16)) {
+        _mm_storeu_si128((__m128i *)pd, _mm_loadu_si128((__m128i const *)ps));
+        pd += 16;
+        ps += 16;
+        len -= UINT32(16);
+    }
+#elif defined(XCP_UTL_SIMD_NEON)
+    while (len >= UINT32(16)) {
+        vst1q_u8(pd, vld1q_u8(ps));
+        pd += 16;
+        ps += 16;
+        len -= UINT32(16);
+    }
+#endif /* XCP_UTL_SIMD_SSE2 */
+    while (len >= UINT32(4)) {
+        pd[0] = ps[0];
+        pd[1] = ps[1];
+        pd[2] = ps[2];
+        pd[3] = ps[3];
+        pd += 4;
+        ps += 4;
+        len -= UINT32(4);
+    }
+    while (len--) {
+        *pd++ = *ps++;
+    }
+}
+
 void XcpUtl_MemSet(/*@out@*/void * dest, uint8_t fill_char, uint32_t len)
 {
     uint8_t * p = (uint8_t *)dest;
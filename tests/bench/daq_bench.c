@@ -0,0 +1,696 @@
+/*
+ * DAQ throughput and latency benchmarks.
+ *
+ * Builds the DAQ core (xcp.c, xcp_daq.c, xcp_util.c) against a null transport and measures
+ *
+ *  - trigger:  `XcpDaq_TriggerEvent()` cost (and the cost of handing the DTOs to the transport)
+ *              vs. number and size of ODT entries,
+ *  - queue:    DTO queue enqueue/dequeue throughput, copying and in place (Reserve/Commit, Peek/Release),
+ *  - latency:  event-to-`XcpTl_Send()` latency percentiles, transmitting inline after the event
+ *              or from a dedicated transmit task,
+ *  - remote:   (--remote, --remote-target) trigger cost sampling another process via
+ *              `process_vm_readv()` (src/hw/linux/remote.c) vs. sampling in-process.
+ *
+ * Results are written to stdout as JSON (default) or CSV, see bench_daq.py.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+#define _DEFAULT_SOURCE     /* MAP_ANONYMOUS */
+
+#include <fcntl.h>
+#include <limits.h>
+#include <pthread.h>
+#include <semaphore.h>
+#include <signal.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "xcp.h"
+#include "xcp_hw.h"
+
+#define XCP_BENCH_MEASUREMENT_AREA      ((void *)0x20000000)
+#define XCP_BENCH_MEASUREMENT_SIZE      (0x10000)
+#define XCP_BENCH_MAX_RESULTS           (256)
+#define XCP_BENCH_MAX_TRIGGER_BATCH     (64)
+#define XCP_BENCH_QUEUE_MESSAGES        (64)
+#define XCP_BENCH_LATENCY_ENTRIES       (64)
+#define XCP_BENCH_LATENCY_SIZE          (4)
+#define XCP_BENCH_DRAIN_TIMEOUT_NS      (5000000000ULL)
+#define XCP_BENCH_TARGET_STARTUP_US     (500000)
+#define XCP_BENCH_LOCAL                 UINT8(0)
+#define XCP_BENCH_REMOTE                UINT8(XCP_REMOTE_MEMORY_ADDRESS_EXTENSION)
+
+XCP_DAQ_BEGIN_EVENTS
+    XCP_DAQ_DEFINE_EVENT("bench", XCP_DAQ_EVENT_CHANNEL_TYPE_DAQ | XCP_DAQ_CONSISTENCY_DAQ_LIST, XCP_DAQ_EVENT_CHANNEL_TIME_UNIT_1MS, 1),
+XCP_DAQ_END_EVENTS
+
+typedef struct tagXcpBench_ResultType {
+    char const * benchmark;
+    char const * mode;
+    char const * param[2];
+    uint32_t paramValue[2];
+    char const * metric;
+    double value;
+} XcpBench_ResultType;
+
+static XcpBench_ResultType XcpBench_Results[XCP_BENCH_MAX_RESULTS];
+static uint16_t XcpBench_ResultCount;
+
+static uint8_t * XcpBench_Signals;
+static uint8_t XcpBench_Payload[XCP_MAX_DTO];
+static uint8_t XcpBench_Dto[XCP_MAX_DTO];
+
+/* Sampled region of the target process, addressed relative to its start. */
+static pid_t XcpBench_RemotePid;
+static uint32_t XcpBench_RemoteSize;
+
+/* Latency bookkeeping, the producer stamps each event, the null transport the arrival of its last ODT. */
+static uint64_t * XcpBench_EventTimes;
+static uint64_t * XcpBench_Latencies;
+static uint32_t XcpBench_LatencySamples;
+static uint8_t XcpBench_LastPid;
+static atomic_bool XcpBench_Recording;
+static atomic_uint XcpBench_Received;
+static atomic_bool XcpBench_Stop;
+
+static pthread_mutex_t XcpBench_Locks[XCP_HW_LOCK_COUNT] = {
+    PTHREAD_MUTEX_INITIALIZER, PTHREAD_MUTEX_INITIALIZER, PTHREAD_MUTEX_INITIALIZER
+};
+static sem_t XcpBench_TransmitRequest;
+
+static uint64_t XcpBench_Now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/*
+**  Null transport and platform stubs.
+*/
+void XcpTl_Init(void)
+{
+    static uint8_t out[XCP_COMM_BUFLEN];
+
+    Xcp_PduOut.data = out;
+}
+
+void XcpTl_DeInit(void) {}
+void XcpTl_MainFunction(void) {}
+void XcpTl_SaveConnection(void) {}
+void XcpTl_ReleaseConnection(void) {}
+void XcpTl_TransportLayerCmd_Res(Xcp_PDUType const * const pdu) {}
+
+void XcpTl_Send(uint8_t const * buf, uint16_t len)
+{
+    uint64_t now;
+    uint32_t received;
+    uint16_t pos = UINT16(0);
+    uint16_t dlc;
+
+    if (!atomic_load_explicit(&XcpBench_Recording, memory_order_relaxed)) {
+        return;
+    }
+    now = XcpBench_Now();
+    /* One packet per call, or several if XCP_ON_ETHERNET_ENABLE_FRAME_BATCHING is on. */
+    while ((pos + XCP_TRANSPORT_LAYER_BUFFER_OFFSET) < len) {
+        dlc = UINT16(buf[pos] | (buf[pos + 1] << 8));
+        if ((buf[pos + XCP_TRANSPORT_LAYER_BUFFER_OFFSET] & UINT8(0x7f)) == XcpBench_LastPid) {
+            received = atomic_load_explicit(&XcpBench_Received, memory_order_relaxed);
+            if (received < XcpBench_LatencySamples) {
+                XcpBench_Latencies[received] = now - XcpBench_EventTimes[received];
+                atomic_store_explicit(&XcpBench_Received, received + 1, memory_order_release);
+            }
+        }
+        pos += UINT16(XCP_TRANSPORT_LAYER_BUFFER_OFFSET + dlc);
+    }
+}
+
+void XcpHw_Init(void) {}
+
+uint32_t XcpHw_GetTimerCounter(void)
+{
+    return UINT32(XcpBench_Now() / 1000ULL);    /* XCP_DAQ_TIMESTAMP_UNIT_1US */
+}
+
+void XcpHw_AcquireLock(uint8_t lockIdx)
+{
+    pthread_mutex_lock(&XcpBench_Locks[lockIdx]);
+}
+
+void XcpHw_ReleaseLock(uint8_t lockIdx)
+{
+    pthread_mutex_unlock(&XcpBench_Locks[lockIdx]);
+}
+
+void XcpHw_WaitTransmitRequest(void)
+{
+    while (sem_wait(&XcpBench_TransmitRequest) != 0) {
+    }
+}
+
+void XcpHw_SignalTransmitRequest(void)
+{
+    sem_post(&XcpBench_TransmitRequest);
+}
+
+bool Xcp_HookFunction_CheckMemoryAccess(Xcp_MtaType mta, uint32_t length, Xcp_MemoryAccessType access, bool programming)
+{
+    return (bool)XCP_TRUE;
+}
+
+Xcp_MemoryMappingResultType Xcp_HookFunction_AddressMapper(Xcp_MtaType * dst, Xcp_MtaType const * src)
+{
+    return XCP_MEMORY_NOT_MAPPED;
+}
+
+bool Xcp_HookFunction_GetSeed(uint8_t resource, Xcp_1DArrayType * result)
+{
+    return (bool)XCP_FALSE;
+}
+
+bool Xcp_HookFunction_Unlock(uint8_t resource, Xcp_1DArrayType const * key)
+{
+    return (bool)XCP_FALSE;
+}
+
+bool Xcp_HookFunction_GetId(uint8_t id_type, char ** result, uint32_t * result_length)
+{
+    return (bool)XCP_FALSE;
+}
+
+/*
+**  Results.
+*/
+static void XcpBench_Record(char const * benchmark, char const * mode, char const * param0, uint32_t value0,
+                            char const * param1, uint32_t value1, char const * metric, double value)
+{
+    XcpBench_ResultType * result;
+
+    if (XcpBench_ResultCount >= XCP_BENCH_MAX_RESULTS) {
+        return;
+    }
+    result = &XcpBench_Results[XcpBench_ResultCount];
+    result->benchmark = benchmark;
+    result->mode = mode;
+    result->param[0] = param0;
+    result->paramValue[0] = value0;
+    result->param[1] = param1;
+    result->paramValue[1] = value1;
+    result->metric = metric;
+    result->value = value;
+    ++XcpBench_ResultCount;
+}
+
+static void XcpBench_WriteJson(uint32_t iterations, uint32_t samples)
+{
+    XcpBench_ResultType const * result;
+    uint16_t idx;
+    uint8_t param;
+
+    printf("{\n  \"config\": {\n");
+    printf("    \"compiler\": \"%s\",\n", __VERSION__);
+    printf("    \"max_dto\": %u,\n", XCP_MAX_DTO);
+    printf("    \"dto_buffer_size\": %u,\n", XCP_DAQ_DTO_BUFFER_SIZE);
+    printf("    \"timestamp_size\": %u,\n", XCP_DAQ_TIMESTAMP_SIZE);
+    printf("    \"lock_free_dto_queue\": %s,\n", (XCP_DAQ_ENABLE_LOCK_FREE_DTO_QUEUE == XCP_ON) ? "true" : "false");
+    printf("    \"frame_batching\": %s,\n", (XCP_ON_ETHERNET_ENABLE_FRAME_BATCHING == XCP_ON) ? "true" : "false");
+    printf("    \"iterations\": %u,\n", iterations);
+    printf("    \"samples\": %u\n", samples);
+    printf("  },\n  \"results\": [\n");
+    for (idx = 0; idx < XcpBench_ResultCount; ++idx) {
+        result = &XcpBench_Results[idx];
+        printf("    {\"benchmark\": \"%s\"", result->benchmark);
+        if (result->mode != XCP_NULL) {
+            printf(", \"mode\": \"%s\"", result->mode);
+        }
+        for (param = 0; param < 2; ++param) {
+            if (result->param[param] != XCP_NULL) {
+                printf(", \"%s\": %u", result->param[param], result->paramValue[param]);
+            }
+        }
+        printf(", \"metric\": \"%s\", \"value\": %.3f}%s\n", result->metric, result->value,
+               (idx + 1 < XcpBench_ResultCount) ? "," : "");
+    }
+    printf("  ]\n}\n");
+}
+
+static void XcpBench_WriteCsv(uint32_t iterations, uint32_t samples)
+{
+    XcpBench_ResultType const * result;
+    uint16_t idx;
+    uint8_t param;
+
+    printf("benchmark,variant,metric,value\n");
+    printf("config,,max_dto,%u\n", XCP_MAX_DTO);
+    printf("config,,dto_buffer_size,%u\n", XCP_DAQ_DTO_BUFFER_SIZE);
+    printf("config,,timestamp_size,%u\n", XCP_DAQ_TIMESTAMP_SIZE);
+    printf("config,,lock_free_dto_queue,%u\n", (XCP_DAQ_ENABLE_LOCK_FREE_DTO_QUEUE == XCP_ON) ? 1 : 0);
+    printf("config,,frame_batching,%u\n", (XCP_ON_ETHERNET_ENABLE_FRAME_BATCHING == XCP_ON) ? 1 : 0);
+    printf("config,,iterations,%u\n", iterations);
+    printf("config,,samples,%u\n", samples);
+    for (idx = 0; idx < XcpBench_ResultCount; ++idx) {
+        result = &XcpBench_Results[idx];
+        printf("%s,", result->benchmark);
+        if (result->mode != XCP_NULL) {
+            printf("%s", result->mode);
+        }
+        for (param = 0; param < 2; ++param) {
+            if (result->param[param] != XCP_NULL) {
+                printf("%s%s=%u", ((param > 0) || (result->mode != XCP_NULL)) ? ";" : "",
+                       result->param[param], result->paramValue[param]);
+            }
+        }
+        printf(",%s,%.3f\n", result->metric, result->value);
+    }
+}
+
+/*
+**  DAQ list setup.
+*/
+
+/*
+**  Configure DAQ list #0 on event #0 with `numEntries` entries of `size` bytes each, in local memory or
+**  (`ext` XCP_BENCH_REMOTE) in the target process; returns the number of ODTs.
+*/
+static uint8_t XcpBench_Configure(uint16_t numEntries, uint8_t size, uint8_t ext)
+{
+    uint32_t const areaSize = (ext == XCP_BENCH_REMOTE) ? XcpBench_RemoteSize : UINT32(XCP_BENCH_MEASUREMENT_SIZE);
+    XcpDaq_ODTEntryType * entry;
+    uint16_t perOdt = UINT16((XCP_MAX_DTO - 1 - XCP_DAQ_TIMESTAMP_SIZE) / size);
+    uint16_t remaining = numEntries;
+    uint16_t offset = UINT16(0);
+    uint8_t numOdts;
+    uint8_t odt;
+    uint16_t idx;
+    uint16_t count;
+
+    perOdt = XCP_MIN(perOdt, UINT16(255));
+    numOdts = UINT8((numEntries + perOdt - 1) / perOdt);
+    (void)XcpDaq_StopAllLists();
+    XcpDaq_SetProcessorState(XCP_DAQ_STATE_STOPPED);
+    if ((XcpDaq_Free() != ERR_SUCCESS) || (XcpDaq_Alloc(1) != ERR_SUCCESS) || (XcpDaq_AllocOdt(0, numOdts) != ERR_SUCCESS)) {
+        return UINT8(0);
+    }
+    for (odt = 0; odt < numOdts; ++odt) {
+        count = XCP_MIN(remaining, perOdt);
+        if (XcpDaq_AllocOdtEntry(0, odt, UINT8(count)) != ERR_SUCCESS) {
+            return UINT8(0);
+        }
+        for (idx = 0; idx < count; ++idx) {
+            /* One signal per eight bytes: 8 byte entries form a single run the gather plan coalesces. */
+            entry = XcpDaq_GetOdtEntry(0, odt, UINT8(idx));
+            if (ext == XCP_BENCH_REMOTE) {
+                entry->mta.address = UINT32(offset);
+            } else {
+                entry->mta.address = UINT32((uintptr_t)&XcpBench_Signals[offset]);
+            }
+            entry->mta.ext = ext;
+            entry->length = UINT32(size);
+            offset = UINT16((offset + 8) % (areaSize & ~UINT32(7)));
+        }
+        remaining -= count;
+    }
+    XcpDaq_AddEventChannel(0, 0);
+    XcpDaq_GetListState(0)->mode = XCP_DAQ_LIST_MODE_SELECTED | XCP_DAQ_LIST_MODE_TIMESTAMP;
+    if (XcpDaq_StartSelectedLists() != ERR_SUCCESS) {
+        return UINT8(0);
+    }
+    XcpDaq_SetProcessorState(XCP_DAQ_STATE_RUNNING);
+    return numOdts;
+}
+
+/*
+**  Benchmarks.
+*/
+static void XcpBench_Trigger(char const * benchmark, char const * mode, uint16_t numEntries, uint8_t size, uint8_t ext,
+                             uint32_t iterations)
+{
+    uint32_t bytesPerEvent;
+    uint32_t batch;
+    uint32_t rounds;
+    uint32_t round;
+    uint32_t idx;
+    uint32_t overruns;
+    uint32_t readErrors;
+    uint64_t start;
+    uint64_t triggerNs = 0ULL;
+    uint64_t transmitNs = 0ULL;
+    uint8_t numOdts;
+    double events;
+
+    numOdts = XcpBench_Configure(numEntries, size, ext);
+    if (numOdts == UINT8(0)) {
+        XcpBench_Record(benchmark, mode, "entries", numEntries, "size", size, "error", 1.0);
+        return;
+    }
+    /* Trigger in batches that fill at most half the DTO buffer, transmit (untimed for the trigger cost) in between. */
+    bytesPerEvent = UINT32(numEntries) * size + XCP_DAQ_TIMESTAMP_SIZE + numOdts;
+    batch = (XCP_DAQ_DTO_BUFFER_SIZE / 2) / (bytesPerEvent + UINT32(numOdts) * 16);
+    batch = XCP_MAX(XCP_MIN(batch, XCP_BENCH_MAX_TRIGGER_BATCH), UINT32(1));
+    rounds = XCP_MAX(iterations / batch, UINT32(1));
+    overruns = XcpDaq_GetEventOverruns(0);
+    readErrors = XcpDaq_GetRemoteReadErrors(0);
+    for (round = 0; round < rounds; ++round) {
+        start = XcpBench_Now();
+        for (idx = 0; idx < batch; ++idx) {
+            XcpDaq_TriggerEvent(0);
+        }
+        triggerNs += XcpBench_Now() - start;
+        start = XcpBench_Now();
+        XcpDaq_MainFunction();
+        transmitNs += XcpBench_Now() - start;
+    }
+    events = (double)rounds * batch;
+    XcpBench_Record(benchmark, mode, "entries", numEntries, "size", size, "ns_per_event", triggerNs / events);
+    XcpBench_Record(benchmark, mode, "entries", numEntries, "size", size, "transmit_ns_per_event", transmitNs / events);
+    XcpBench_Record(benchmark, mode, "entries", numEntries, "size", size, "sampled_mb_per_s",
+                    ((double)numEntries * size * events) / ((double)triggerNs / 1e3));
+    XcpBench_Record(benchmark, mode, "entries", numEntries, "size", size, "overruns",
+                    (double)(XcpDaq_GetEventOverruns(0) - overruns));
+    if (ext == XCP_BENCH_REMOTE) {
+        XcpBench_Record(benchmark, mode, "entries", numEntries, "size", size, "read_errors",
+                        (double)(XcpDaq_GetRemoteReadErrors(0) - readErrors));
+    }
+}
+
+static void XcpBench_Queue(uint8_t dlc, bool inPlace, uint32_t iterations)
+{
+    XcpDaq_MessageType msg;
+    uint8_t * dto;
+    uint32_t rounds = XCP_MAX(iterations / XCP_BENCH_QUEUE_MESSAGES, UINT32(1));
+    uint32_t round;
+    uint32_t idx;
+    uint32_t failed = UINT32(0);
+    uint64_t start;
+    uint64_t enqueueNs = 0ULL;
+    uint64_t dequeueNs = 0ULL;
+    char const * mode = inPlace ? "in_place" : "copy";
+    double messages;
+
+    (void)XcpDaq_StopAllLists();
+    XcpDaq_SetProcessorState(XCP_DAQ_STATE_STOPPED);
+    memset(XcpBench_Payload, 0x55, sizeof(XcpBench_Payload));
+    for (round = 0; round < rounds; ++round) {
+        start = XcpBench_Now();
+        for (idx = 0; idx < XCP_BENCH_QUEUE_MESSAGES; ++idx) {
+            if (inPlace) {
+                dto = XcpDaq_ReserveMessage(0, 0, dlc);
+                if (dto == XCP_NULL) {
+                    ++failed;
+                    continue;
+                }
+                memcpy(dto, XcpBench_Payload, dlc);
+                XcpDaq_CommitMessage(0, 0, dlc);
+            } else {
+                msg.dlc = dlc;
+                msg.data = XcpBench_Payload;
+                if (!XcpDaq_EnqueueMessage(0, 0, &msg)) {
+                    ++failed;
+                }
+            }
+        }
+        enqueueNs += XcpBench_Now() - start;
+        start = XcpBench_Now();
+        if (inPlace) {
+            while (XcpDaq_PeekMessage(&msg)) {
+                __asm__ __volatile__("" : : "r"(msg.data) : "memory");
+                XcpDaq_ReleaseMessage();
+            }
+        } else {
+            msg.data = XcpBench_Dto;
+            while (XcpDaq_DequeueMessage(&msg)) {
+                __asm__ __volatile__("" : : "r"(XcpBench_Dto) : "memory");
+            }
+        }
+        dequeueNs += XcpBench_Now() - start;
+    }
+    messages = (double)rounds * XCP_BENCH_QUEUE_MESSAGES;
+    XcpBench_Record("queue", mode, "dlc", dlc, XCP_NULL, 0, "ns_per_enqueue", enqueueNs / messages);
+    XcpBench_Record("queue", mode, "dlc", dlc, XCP_NULL, 0, "ns_per_dequeue", dequeueNs / messages);
+    XcpBench_Record("queue", mode, "dlc", dlc, XCP_NULL, 0, "mb_per_s",
+                    ((double)dlc * messages) / ((double)(enqueueNs + dequeueNs) / 1e3));
+    XcpBench_Record("queue", mode, "dlc", dlc, XCP_NULL, 0, "failed", (double)failed);
+}
+
+static void * XcpBench_TransmitTask(void * arg)
+{
+    (void)arg;
+    while (!atomic_load(&XcpBench_Stop)) {
+        XcpDaq_TransmitMainFunction();
+    }
+    return NULL;
+}
+
+static int XcpBench_CompareLatency(void const * lhs, void const * rhs)
+{
+    uint64_t const a = *(uint64_t const *)lhs;
+    uint64_t const b = *(uint64_t const *)rhs;
+
+    return (a > b) - (a < b);
+}
+
+static double XcpBench_Percentile(uint32_t count, double quantile)
+{
+    uint32_t idx = UINT32(quantile * count);
+
+    return (double)XcpBench_Latencies[XCP_MIN(idx, count - 1)];
+}
+
+/* Event-to-XcpTl_Send() latency; `task` transmits from a dedicated thread, otherwise right after each event. */
+static void XcpBench_Latency(bool task, uint32_t samples, uint32_t periodUs)
+{
+    pthread_t transmitter;
+    struct timespec next;
+    char const * mode = task ? "task" : "inline";
+    uint64_t deadline;
+    uint64_t sum = 0ULL;
+    uint32_t overruns;
+    uint32_t received;
+    uint32_t idx;
+    uint8_t numOdts;
+
+    numOdts = XcpBench_Configure(XCP_BENCH_LATENCY_ENTRIES, XCP_BENCH_LATENCY_SIZE, XCP_BENCH_LOCAL);
+    if (numOdts == UINT8(0)) {
+        XcpBench_Record("latency", mode, "entries", XCP_BENCH_LATENCY_ENTRIES, "size", XCP_BENCH_LATENCY_SIZE, "error", 1.0);
+        return;
+    }
+    XcpBench_LastPid = UINT8(numOdts - 1);
+    XcpBench_LatencySamples = samples;
+    atomic_store(&XcpBench_Received, 0);
+    atomic_store(&XcpBench_Stop, (bool)XCP_FALSE);
+    atomic_store(&XcpBench_Recording, (bool)XCP_TRUE);
+    overruns = XcpDaq_GetEventOverruns(0);
+    if (task && (pthread_create(&transmitter, NULL, XcpBench_TransmitTask, NULL) != 0)) {
+        task = (bool)XCP_FALSE;
+        mode = "inline";
+    }
+    clock_gettime(CLOCK_MONOTONIC, &next);
+    for (idx = 0; idx < samples; ++idx) {
+        if (task) {
+            /* Pace the events so the measurement shows latency, not queueing behind a backlog. */
+            next.tv_nsec += (long)periodUs * 1000L;
+            while (next.tv_nsec >= 1000000000L) {
+                next.tv_nsec -= 1000000000L;
+                ++next.tv_sec;
+            }
+            clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next, NULL);
+        }
+        XcpBench_EventTimes[idx] = XcpBench_Now();
+        XcpDaq_TriggerEvent(0);
+        if (!task) {
+            XcpDaq_MainFunction();
+        }
+    }
+    deadline = XcpBench_Now() + XCP_BENCH_DRAIN_TIMEOUT_NS;
+    while ((atomic_load_explicit(&XcpBench_Received, memory_order_acquire) < samples) && (XcpBench_Now() < deadline)) {
+        sched_yield();
+    }
+    if (task) {
+        atomic_store(&XcpBench_Stop, (bool)XCP_TRUE);
+        XcpHw_SignalTransmitRequest();
+        pthread_join(transmitter, NULL);
+    }
+    atomic_store(&XcpBench_Recording, (bool)XCP_FALSE);
+    received = atomic_load(&XcpBench_Received);
+    XcpBench_Record("latency", mode, "entries", XCP_BENCH_LATENCY_ENTRIES, "size", XCP_BENCH_LATENCY_SIZE, "samples", (double)received);
+    XcpBench_Record("latency", mode, "entries", XCP_BENCH_LATENCY_ENTRIES, "size", XCP_BENCH_LATENCY_SIZE, "overruns",
+                    (double)(XcpDaq_GetEventOverruns(0) - overruns));
+    if (received == UINT32(0)) {
+        return;
+    }
+    qsort(XcpBench_Latencies, received, sizeof(uint64_t), XcpBench_CompareLatency);
+    for (idx = 0; idx < received; ++idx) {
+        sum += XcpBench_Latencies[idx];
+    }
+    XcpBench_Record("latency", mode, "entries", XCP_BENCH_LATENCY_ENTRIES, "size", XCP_BENCH_LATENCY_SIZE, "mean_ns", (double)sum / received);
+    XcpBench_Record("latency", mode, "entries", XCP_BENCH_LATENCY_ENTRIES, "size", XCP_BENCH_LATENCY_SIZE, "p50_ns", XcpBench_Percentile(received, 0.5));
+    XcpBench_Record("latency", mode, "entries", XCP_BENCH_LATENCY_ENTRIES, "size", XCP_BENCH_LATENCY_SIZE, "p90_ns", XcpBench_Percentile(received, 0.9));
+    XcpBench_Record("latency", mode, "entries", XCP_BENCH_LATENCY_ENTRIES, "size", XCP_BENCH_LATENCY_SIZE, "p99_ns", XcpBench_Percentile(received, 0.99));
+    XcpBench_Record("latency", mode, "entries", XCP_BENCH_LATENCY_ENTRIES, "size", XCP_BENCH_LATENCY_SIZE, "p999_ns", XcpBench_Percentile(received, 0.999));
+    XcpBench_Record("latency", mode, "entries", XCP_BENCH_LATENCY_ENTRIES, "size", XCP_BENCH_LATENCY_SIZE, "max_ns", (double)XcpBench_Latencies[received - 1]);
+}
+
+/* Start `path` (or, if NULL, a sleeping copy of this process) and select its first writable mapping for sampling. */
+static bool XcpBench_StartTarget(char const * path)
+{
+    char maps[64];
+    char line[PATH_MAX + 128];
+    char image[PATH_MAX];
+    char mapped[PATH_MAX];
+    char perms[8];
+    unsigned long begin;
+    unsigned long end;
+    FILE * fp;
+    int fd;
+
+    if ((path != XCP_NULL) && (realpath(path, image) == XCP_NULL)) {
+        return (bool)XCP_FALSE;
+    }
+    /* Forked, so the target is our descendant and ptrace access needs no privileges. */
+    XcpBench_RemotePid = fork();
+    if (XcpBench_RemotePid == (pid_t)-1) {
+        return (bool)XCP_FALSE;
+    }
+    if (XcpBench_RemotePid == (pid_t)0) {
+        if (path == XCP_NULL) {
+            for (;;) {
+                pause();
+            }
+        }
+        fd = open("/dev/null", O_RDWR);
+        dup2(fd, STDIN_FILENO);
+        dup2(fd, STDOUT_FILENO);
+        dup2(fd, STDERR_FILENO);
+        execl(image, image, (char *)NULL);
+        _exit(127);
+    }
+    if (path == XCP_NULL) {
+        /* The copy shares the layout of the measurement area. */
+        XcpHw_SetRemoteProcess((int32_t)XcpBench_RemotePid, (uintptr_t)XcpBench_Signals);
+        XcpBench_RemoteSize = UINT32(XCP_BENCH_MEASUREMENT_SIZE);
+        return (bool)XCP_TRUE;
+    }
+    usleep(XCP_BENCH_TARGET_STARTUP_US);
+    snprintf(maps, sizeof(maps), "/proc/%d/maps", (int)XcpBench_RemotePid);
+    fp = fopen(maps, "r");
+    if (fp == XCP_NULL) {
+        return (bool)XCP_FALSE;
+    }
+    while (fgets(line, sizeof(line), fp) != XCP_NULL) {
+        /* .data/.bss of the executable. */
+        if ((sscanf(line, "%lx-%lx %7s %*s %*s %*s %4095s", &begin, &end, perms, mapped) == 4) &&
+            (perms[0] == 'r') && (perms[1] == 'w') && (strcmp(mapped, image) == 0)) {
+            fclose(fp);
+            XcpHw_SetRemoteProcess((int32_t)XcpBench_RemotePid, (uintptr_t)begin);
+            XcpBench_RemoteSize = UINT32(XCP_MIN(end - begin, (unsigned long)XCP_BENCH_MEASUREMENT_SIZE));
+            return (bool)XCP_TRUE;
+        }
+    }
+    fclose(fp);
+    return (bool)XCP_FALSE;
+}
+
+static void XcpBench_StopTarget(void)
+{
+    XcpHw_SetRemoteProcess(0, (uintptr_t)0);
+    if (XcpBench_RemotePid > (pid_t)0) {
+        kill(XcpBench_RemotePid, SIGTERM);
+        waitpid(XcpBench_RemotePid, NULL, 0);
+    }
+}
+
+static void XcpBench_Usage(char const * name)
+{
+    fprintf(stderr, "usage: %s [--format json|csv] [--iterations N] [--samples N] [--period-us N] [--remote] [--remote-target PATH]\n", name);
+}
+
+int main(int argc, char ** argv)
+{
+    static const uint16_t entryCounts[] = {1, 16, 64, 256, 1024};
+    static const uint8_t entrySizes[] = {1, 2, 4, 8};
+    static const uint8_t dlcs[] = {8, 64, 255};
+    uint32_t iterations = UINT32(20000);
+    uint32_t samples = UINT32(10000);
+    uint32_t periodUs = UINT32(100);
+    bool csv = (bool)XCP_FALSE;
+    bool remote = (bool)XCP_FALSE;
+    char const * target = XCP_NULL;
+    uint8_t count;
+    uint8_t size;
+    int arg;
+
+    for (arg = 1; arg < argc; ++arg) {
+        if ((strcmp(argv[arg], "--format") == 0) && (arg + 1 < argc)) {
+            csv = (strcmp(argv[++arg], "csv") == 0);
+        } else if ((strcmp(argv[arg], "--iterations") == 0) && (arg + 1 < argc)) {
+            iterations = UINT32(strtoul(argv[++arg], NULL, 0));
+        } else if ((strcmp(argv[arg], "--samples") == 0) && (arg + 1 < argc)) {
+            samples = UINT32(strtoul(argv[++arg], NULL, 0));
+        } else if ((strcmp(argv[arg], "--period-us") == 0) && (arg + 1 < argc)) {
+            periodUs = UINT32(strtoul(argv[++arg], NULL, 0));
+        } else if (strcmp(argv[arg], "--remote") == 0) {
+            remote = (bool)XCP_TRUE;
+        } else if ((strcmp(argv[arg], "--remote-target") == 0) && (arg + 1 < argc)) {
+            remote = (bool)XCP_TRUE;
+            target = argv[++arg];
+        } else {
+            XcpBench_Usage(argv[0]);
+            return 2;
+        }
+    }
+    /* ODT entry addresses are 32 bits wide, so the measured signals must live below 4GB. */
+    XcpBench_Signals = (uint8_t *)mmap(XCP_BENCH_MEASUREMENT_AREA, XCP_BENCH_MEASUREMENT_SIZE, PROT_READ | PROT_WRITE,
+                                       MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if ((XcpBench_Signals == (uint8_t *)MAP_FAILED) || ((uintptr_t)XcpBench_Signals >= 0x100000000ULL)) {
+        fprintf(stderr, "no memory below 4GB available\n");
+        return 1;
+    }
+    samples = XCP_MAX(samples, UINT32(1));
+    XcpBench_EventTimes = (uint64_t *)calloc(samples, sizeof(uint64_t));
+    XcpBench_Latencies = (uint64_t *)calloc(samples, sizeof(uint64_t));
+    if ((XcpBench_EventTimes == XCP_NULL) || (XcpBench_Latencies == XCP_NULL)) {
+        return 1;
+    }
+    sem_init(&XcpBench_TransmitRequest, 0, 0);
+    Xcp_Init();
+
+    for (count = 0; count < (uint8_t)(sizeof(entryCounts) / sizeof(entryCounts[0])); ++count) {
+        for (size = 0; size < (uint8_t)sizeof(entrySizes); ++size) {
+            XcpBench_Trigger("trigger", XCP_NULL, entryCounts[count], entrySizes[size], XCP_BENCH_LOCAL, iterations);
+        }
+    }
+    for (size = 0; size < (uint8_t)sizeof(dlcs); ++size) {
+        XcpBench_Queue(dlcs[size], (bool)XCP_FALSE, iterations);
+        XcpBench_Queue(dlcs[size], (bool)XCP_TRUE, iterations);
+    }
+    XcpBench_Latency((bool)XCP_FALSE, samples, periodUs);
+    XcpBench_Latency((bool)XCP_TRUE, samples, periodUs);
+    if (remote) {
+        if (!XcpBench_StartTarget(target)) {
+            XcpBench_Record("remote", XCP_NULL, XCP_NULL, 0, XCP_NULL, 0, "error", 1.0);
+        } else {
+            for (count = 0; count < (uint8_t)(sizeof(entryCounts) / sizeof(entryCounts[0])); ++count) {
+                for (size = 0; size < (uint8_t)sizeof(entrySizes); ++size) {
+                    XcpBench_Trigger("remote", "in_process", entryCounts[count], entrySizes[size], XCP_BENCH_LOCAL, iterations);
+                    XcpBench_Trigger("remote", "remote", entryCounts[count], entrySizes[size], XCP_BENCH_REMOTE, iterations);
+                }
+            }
+        }
+        XcpBench_StopTarget();
+    }
+
+    if (csv) {
+        XcpBench_WriteCsv(iterations, samples);
+    } else {
+        XcpBench_WriteJson(iterations, samples);
+    }
+    return 0;
+}
@@ -0,0 +1,135 @@
+/*
+ * BlueParrot XCP
+ *
+ * (C) 2007-2020 by Christoph Schueler <github.com/Christoph2,
+ *                                      cpu12.gems@googlemail.com>
+ *
+ * All Rights Reserved
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * s. FLOSS-EXCEPTION.txt
+ */
+
+/*
+ *  For details on options refer to `documentation <https://github.com/christoph2/cxcp/docs/options.rst>`_
+ */
+
+#if !defined(__XCP_CONFIG_H)
+#define __XCP_CONFIG_H
+
+/*
+ *  Configuration of the DAQ benchmarks (bench/daq_bench.c), options guarded by
+ *  `#if !defined` may be overridden from the command line, s. bench_daq.py --define.
+ */
+#define XCP_GET_ID_0                                "BlueParrot XCP benchmarks"
+#define XCP_GET_ID_1                                "Example_Project"
+
+#define XCP_BUILD_TYPE                              XCP_RELEASE_BUILD
+
+#define XCP_EXTERN_C_GUARDS                         XCP_OFF
+
+#define XCP_ENABLE_SLAVE_BLOCKMODE                  XCP_OFF
+#define XCP_ENABLE_MASTER_BLOCKMODE                 XCP_OFF
+
+#define XCP_ENABLE_STIM                             XCP_OFF
+
+#define XCP_CHECKSUM_METHOD                         XCP_CHECKSUM_METHOD_XCP_CRC_16_CITT
+#define XCP_CHECKSUM_CHUNKED_CALCULATION            XCP_ON
+#define XCP_CHECKSUM_CHUNK_SIZE                     (64)
+#define XCP_CHECKSUM_MAXIMUM_BLOCK_SIZE             (0)     /* 0 ==> unlimited */
+
+#define XCP_BYTE_ORDER                              XCP_BYTE_ORDER_INTEL
+#define XCP_ADDRESS_GRANULARITY                     XCP_ADDRESS_GRANULARITY_BYTE
+
+#define XCP_ENABLE_STATISTICS                       XCP_OFF
+
+#define XCP_ENABLE_DAQ_COMMANDS                     XCP_ON
+#define XCP_ENABLE_GET_SEED                         XCP_ON
+#define XCP_ENABLE_UNLOCK                           XCP_ON
+
+#define XCP_PROTECT_CAL                             XCP_OFF
+#define XCP_PROTECT_PAG                             XCP_OFF
+#define XCP_PROTECT_DAQ                             XCP_OFF
+#define XCP_PROTECT_STIM                            XCP_OFF
+#define XCP_PROTECT_PGM                             XCP_OFF
+
+/*
+ * **  Transport-Layer (null transport, see XcpTl_Send() in bench/daq_bench.c).
+ * */
+#define XCP_TRANSPORT_LAYER                         XCP_ON_ETHERNET
+
+#define XCP_MAX_CTO                                 (255)
+#define XCP_MAX_DTO                                 (255)
+
+#define XCP_TRANSPORT_LAYER_LENGTH_SIZE             (2)
+#define XCP_TRANSPORT_LAYER_COUNTER_SIZE            (2)
+#define XCP_TRANSPORT_LAYER_CHECKSUM_SIZE           (0)
+
+#if !defined(XCP_ON_ETHERNET_ENABLE_FRAME_BATCHING)
+#define XCP_ON_ETHERNET_ENABLE_FRAME_BATCHING       XCP_OFF
+#endif
+
+/*
+ * **  DAQ Settings.
+ * */
+#define XCP_DAQ_CONFIG_TYPE                         XCP_DAQ_CONFIG_TYPE_DYNAMIC
+#if !defined(XCP_DAQ_DTO_BUFFER_SIZE)
+#define XCP_DAQ_DTO_BUFFER_SIZE                     (65536)
+#endif
+#define XCP_DAQ_ENABLE_PREDEFINED_LISTS             XCP_OFF
+#define XCP_DAQ_TIMESTAMP_UNIT                      (XCP_DAQ_TIMESTAMP_UNIT_1US)
+#define XCP_DAQ_TIMESTAMP_SIZE                      (XCP_DAQ_TIMESTAMP_SIZE_4)
+#define XCP_DAQ_ENABLE_PRESCALER                    XCP_ON
+#define XCP_DAQ_ENABLE_ADDR_EXT                     XCP_ON     /* Selects remote memory. */
+#define XCP_DAQ_ENABLE_BIT_OFFSET                   XCP_OFF
+#define XCP_DAQ_ENABLE_PRIORITIZATION               XCP_ON
+#define XCP_DAQ_OVERLOAD_INDICATION                 XCP_DAQ_OVERLOAD_INDICATION_PID
+#define XCP_DAQ_ENABLE_SEQLOCK                      XCP_OFF
+#define XCP_DAQ_ENABLE_RESUME                       XCP_OFF
+#define XCP_DAQ_ENABLE_ALTERNATING                  XCP_OFF
+#define XCP_DAQ_ENABLE_CLOCK_ACCESS_ALWAYS          XCP_ON
+#define XCP_DAQ_ENABLE_WRITE_THROUGH                XCP_OFF
+#define XCP_DAQ_MAX_DYNAMIC_ENTITIES                (4096)
+#define XCP_DAQ_MAX_EVENT_CHANNEL                   (1)
+#define XCP_DAQ_ENABLE_MULTIPLE_DAQ_LISTS_PER_EVENT XCP_OFF
+#if !defined(XCP_DAQ_ENABLE_LOCK_FREE_DTO_QUEUE)
+#define XCP_DAQ_ENABLE_LOCK_FREE_DTO_QUEUE          XCP_ON
+#endif
+#define XCP_DAQ_ENABLE_TRANSMIT_TASK                XCP_ON
+
+#define XCP_ENABLE_REMOTE_MEMORY                    XCP_ON
+#define XCP_REMOTE_MEMORY_ADDRESS_EXTENSION         (0x01)
+
+
+/*
+ * **  Platform Specific Options.
+ * */
+#define XCP_ENTER_CRITICAL()        XcpHw_AcquireLock(XCP_HW_LOCK_XCP)
+#define XCP_LEAVE_CRITICAL()        XcpHw_ReleaseLock(XCP_HW_LOCK_XCP)
+#define XCP_TL_ENTER_CRITICAL()     XcpHw_AcquireLock(XCP_HW_LOCK_TL)
+#define XCP_TL_LEAVE_CRITICAL()     XcpHw_ReleaseLock(XCP_HW_LOCK_TL)
+#define XCP_DAQ_ENTER_CRITICAL()    XcpHw_AcquireLock(XCP_HW_LOCK_DAQ)
+#define XCP_DAQ_LEAVE_CRITICAL()    XcpHw_ReleaseLock(XCP_HW_LOCK_DAQ)
+#define XCP_STIM_ENTER_CRITICAL()
+#define XCP_STIM_LEAVE_CRITICAL()
+#define XCP_PGM_ENTER_CRITICAL()
+#define XCP_PGM_LEAVE_CRITICAL()
+#define XCP_CAL_ENTER_CRITICAL()
+#define XCP_CAL_LEAVE_CRITICAL()
+#define XCP_PAG_ENTER_CRITICAL()
+#define XCP_PAG_LEAVE_CRITICAL()
+
+#endif /* __XCP_CONFIG_H */
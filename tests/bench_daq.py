@@ -0,0 +1,68 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+"""DAQ throughput and latency benchmarks (bench/daq_bench.c).
+
+Builds the DAQ core optimized (the test libraries are built with -O0 for coverage) against
+a null transport and the configuration in bench/xcp_config.h, runs it and writes the results
+as JSON or CSV, e.g. to keep them per release and compare:
+
+    python bench_daq.py --format csv -o results-$(git describe).csv
+    python bench_daq.py -D XCP_DAQ_ENABLE_LOCK_FREE_DTO_QUEUE=XCP_OFF
+
+Remote sampling (process_vm_readv) is compared against in-process sampling with --remote,
+sampling a forked copy of the benchmark, or a real target, e.g. the simulator:
+
+    python bench_daq.py --remote-target ../examples/simlin/xcp_sim_eth
+"""
+
+import argparse
+import os
+import subprocess
+import sys
+
+HERE = os.path.abspath(os.path.dirname(__file__))
+EXE = os.path.join(HERE, "daq_bench")
+SOURCES = "../src/xcp.c ../src/xcp_daq.c ../src/xcp_util.c ../src/xcp_checksum.c ../src/hw/linux/remote.c bench/daq_bench.c"
+
+
+def build(cflags, defines):
+    subprocess.check_call(
+        "gcc -std=c11 -O2 {} {} -I../inc -Ibench {} -lpthread -o {}".format(
+            cflags, " ".join("-D{}".format(d) for d in defines), SOURCES, EXE
+        ),
+        shell = True, cwd = HERE
+    )
+
+
+def main():
+    parser = argparse.ArgumentParser(description = __doc__, formatter_class = argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--format", choices = ("json", "csv"), default = "json")
+    parser.add_argument("-n", "--iterations", type = int, default = 20000, help = "events / messages per trigger and queue case")
+    parser.add_argument("--samples", type = int, default = 10000, help = "events per latency case")
+    parser.add_argument("--period-us", type = int, default = 100, help = "event period of the transmit task latency case")
+    parser.add_argument("--cflags", default = "-march=native")
+    parser.add_argument("-D", "--define", action = "append", default = [], help = "override an option of bench/xcp_config.h")
+    parser.add_argument("--remote", action = "store_true", help = "also compare remote vs. in-process sampling")
+    parser.add_argument("--remote-target", help = "executable to sample remotely (its .data/.bss), implies --remote")
+    parser.add_argument("-o", "--output", help = "write results to file instead of stdout")
+    args = parser.parse_args()
+
+    build(args.cflags, args.define)
+    cmd = [
+        EXE, "--format", args.format, "--iterations", str(args.iterations),
+        "--samples", str(args.samples), "--period-us", str(args.period_us)
+    ]
+    if args.remote_target:
+        cmd += ["--remote-target", os.path.abspath(args.remote_target)]
+    elif args.remote:
+        cmd.append("--remote")
+    result = subprocess.check_output(cmd).decode()
+    if args.output:
+        with open(args.output, "w") as of:
+            of.write(result)
+    else:
+        sys.stdout.write(result)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,45 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+"""Compare XcpUtl_SampleCopy against the XcpUtl_MemCopy byte loop.
+
+Builds an optimized library (the test libraries are built with -O0 for coverage)
+and prints nanoseconds per ODT for several ODT layouts.
+"""
+
+import argparse
+import ctypes
+import os
+import subprocess
+
+HERE = os.path.abspath(os.path.dirname(__file__))
+SO = os.path.join(HERE, "bench_sample_copy.so")
+
+
+def build(cflags):
+    subprocess.check_call(
+        "gcc -std=c11 -O2 {} -fPIC -shared -I../inc -I. ../src/xcp_util.c sample_copy_bench.c -o {}".format(cflags, SO),
+        shell = True, cwd = HERE
+    )
+
+
+def main():
+    parser = argparse.ArgumentParser(description = __doc__)
+    parser.add_argument("-n", "--iterations", type = int, default = 2000000)
+    parser.add_argument("--cflags", default = "-march=native", help = "e.g. '-mno-sse2' for the portable path")
+    args = parser.parse_args()
+
+    build(args.cflags)
+    dll = ctypes.CDLL(SO)
+    dll.XcpUtlBench_SampleCopy.argtypes = [ctypes.c_uint8, ctypes.c_uint32, ctypes.POINTER(ctypes.c_uint64), ctypes.POINTER(ctypes.c_uint64)]
+    print("{:>8} {:>14} {:>14} {:>8}".format("ODT", "byte loop ns", "kernel ns", "speedup"))
+    for width, name in ((0, "mixed"), (1, "1 byte"), (2, "2 byte"), (4, "4 byte"), (8, "8 byte")):
+        byte_loop = ctypes.c_uint64()
+        kernel = ctypes.c_uint64()
+        dll.XcpUtlBench_SampleCopy(width, args.iterations, ctypes.byref(byte_loop), ctypes.byref(kernel))
+        print("{:>8} {:>14.2f} {:>14.2f} {:>7.2f}x".format(
+            name, byte_loop.value / args.iterations, kernel.value / args.iterations, byte_loop.value / max(kernel.value, 1)
+        ))
+
+
+if __name__ == '__main__':
+    main()
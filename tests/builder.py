@@ -7,6 +7,7 @@ import subprocess
 
 CFLAGS_OBJ = "-Wall -g -std=c11 -O0 -fPIC -shared -c -I../inc -I."
 CFLAGS_SO = "-shared"
+CFLAGS_SLAVE = "-Wall -g -std=gnu11 -O0 -fPIC -shared -I../inc -Islave"
 GCOV = ""
 
 class Builder:
@@ -34,14 +35,19 @@ class Builder:
     def build_so(self, so, *objs):
         self.run("gcc", CFLAGS_SO, " ".join(objs), "-o {}".format(so), "-ftest-coverage -fprofile-arcs")
 
+    def build_slave(self, so, *sources):
+        """slave/xcp_config.h differs from ours, so objects of the same sources can't be shared."""
+        self.run("gcc", CFLAGS_SLAVE, " ".join(sources), "-o {}".format(so))
+
 
 def main():
     builder = Builder()
     builder.clean()
     #print(builder.run("ls", "-l", "-S", "-R", "*py"))
-    builder.build_objs("checksum_mocks.c", "xcp_init.c", "../src/xcp_checksum.c", "../src/xcp_daq.c", "../src/xcp_util.c")
+    builder.build_objs("checksum_mocks.c", "xcp_init.c", "../src/xcp_checksum.c", "../src/xcp_daq.c", "../src/xcp_util.c", "dto_queue_stress.c", "seqlock_stress.c", "plan_stress.c")
     builder.build_so("test_cs.so", "checksum_mocks.o", "xcp_checksum.o")
-    builder.build_so("test_daq.so", "xcp_daq.o", "xcp_util.o", "xcp_init.o")
+    builder.build_so("test_daq.so", "xcp_daq.o", "xcp_util.o", "xcp_init.o", "dto_queue_stress.o", "seqlock_stress.o", "plan_stress.o", "-lpthread")
+    builder.build_slave("test_slave.so", "../src/xcp.c", "../src/xcp_daq.c", "../src/xcp_util.c", "../src/hw/linux/remote.c", "slave/slave_mocks.c")
 
 if __name__ == '__main__':
     main()
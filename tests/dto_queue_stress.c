@@ -0,0 +1,182 @@
+/*
+ * Concurrent producer/consumer test for the DTO message queues.
+ *
+ * One producer thread per event channel enqueues `count` messages of varying length
+ * while the calling thread merges and verifies them; returns the number of mismatches
+ * (including per-event ordering violations).
+ *
+ * With `blocking` set the calling thread sleeps in XcpDaq_WaitForMessages() whenever the
+ * queues run empty, a lost wake-up shows up as a timed out wait.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <errno.h>
+#include <pthread.h>
+#include <sched.h>
+#include <semaphore.h>
+#include <stdatomic.h>
+#include <time.h>
+
+#include "xcp.h"
+
+void XcpDaq_InitMessageQueue(void);
+
+#define XCP_DAQ_TEST_WAIT_TIMEOUT_SEC   (5)
+
+static sem_t XcpDaqTest_TransmitRequest;
+static atomic_uint XcpDaqTest_Signals;
+static atomic_uint XcpDaqTest_Waits;
+static atomic_uint XcpDaqTest_TimedOutWaits;
+
+static void XcpDaqTest_InitTransmitRequest(void)
+{
+    static bool initialized = false;
+
+    if (!initialized) {
+        sem_init(&XcpDaqTest_TransmitRequest, 0, 0);
+        initialized = true;
+    }
+    while (sem_trywait(&XcpDaqTest_TransmitRequest) == 0) {
+    }
+    atomic_store(&XcpDaqTest_Signals, 0);
+    atomic_store(&XcpDaqTest_Waits, 0);
+    atomic_store(&XcpDaqTest_TimedOutWaits, 0);
+}
+
+void XcpHw_WaitTransmitRequest(void)
+{
+    struct timespec deadline;
+
+    atomic_fetch_add(&XcpDaqTest_Waits, 1);
+    clock_gettime(CLOCK_REALTIME, &deadline);
+    deadline.tv_sec += XCP_DAQ_TEST_WAIT_TIMEOUT_SEC;
+    while (sem_timedwait(&XcpDaqTest_TransmitRequest, &deadline) == -1) {
+        if (errno != EINTR) {
+            atomic_fetch_add(&XcpDaqTest_TimedOutWaits, 1);
+            return;
+        }
+    }
+}
+
+void XcpHw_SignalTransmitRequest(void)
+{
+    atomic_fetch_add(&XcpDaqTest_Signals, 1);
+    sem_post(&XcpDaqTest_TransmitRequest);
+}
+
+/* Get the number of wake-ups signalled, blocking waits and pending (unconsumed) wake-ups since the last reset. */
+void XcpDaqTest_GetTransmitRequests(uint32_t * signals, uint32_t * waits, uint32_t * pending)
+{
+    int value = 0;
+
+    sem_getvalue(&XcpDaqTest_TransmitRequest, &value);
+    *signals = atomic_load(&XcpDaqTest_Signals);
+    *waits = atomic_load(&XcpDaqTest_Waits);
+    *pending = UINT32(value);
+}
+
+void XcpDaqTest_ResetTransmitRequests(void)
+{
+    XcpDaqTest_InitTransmitRequest();
+}
+
+typedef struct tagXcpDaqTest_ProducerType {
+    uint16_t eventChannelNumber;
+    uint32_t count;
+} XcpDaqTest_ProducerType;
+
+static uint8_t XcpDaqTest_Dlc(uint32_t seq)
+{
+    return UINT8(4 + (seq % 5));
+}
+
+static uint8_t XcpDaqTest_Byte(uint32_t seq, uint8_t idx)
+{
+    return UINT8((seq * 7 + idx) & 0xff);
+}
+
+static void * XcpDaqTest_Producer(void * arg)
+{
+    XcpDaqTest_ProducerType const * producer = (XcpDaqTest_ProducerType const *)arg;
+    uint8_t payload[8];
+    XcpDaq_MessageType msg;
+    uint32_t seq;
+    uint8_t idx;
+
+    for (seq = 0; seq < producer->count; ++seq) {
+        msg.dlc = XcpDaqTest_Dlc(seq);
+        payload[0] = UINT8(producer->eventChannelNumber);
+        payload[1] = UINT8(seq & 0xff);
+        payload[2] = UINT8((seq >> 8) & 0xff);
+        payload[3] = UINT8((seq >> 16) & 0xff);
+        for (idx = 4; idx < msg.dlc; ++idx) {
+            payload[idx] = XcpDaqTest_Byte(seq, idx);
+        }
+        msg.data = payload;
+        while (!XcpDaq_EnqueueMessage(producer->eventChannelNumber, UINT8(0), &msg)) {
+            sched_yield();
+        }
+    }
+    return NULL;
+}
+
+uint32_t XcpDaqTest_DtoQueueStress(uint16_t numProducers, uint32_t count, bool blocking)
+{
+    pthread_t threads[XCP_DAQ_MAX_EVENT_CHANNEL];
+    XcpDaqTest_ProducerType producers[XCP_DAQ_MAX_EVENT_CHANNEL];
+    uint32_t expected[XCP_DAQ_MAX_EVENT_CHANNEL] = {0};
+    uint8_t payload[XCP_DAQ_DTO_BUFFER_SIZE];
+    XcpDaq_MessageType msg;
+    uint32_t errors = 0;
+    uint32_t received = 0;
+    uint32_t seq;
+    uint16_t event;
+    uint8_t idx;
+
+    if ((numProducers == 0) || (numProducers > XCP_DAQ_MAX_EVENT_CHANNEL)) {
+        return count;
+    }
+    XcpDaq_InitMessageQueue();
+    XcpDaqTest_InitTransmitRequest();
+    for (event = 0; event < numProducers; ++event) {
+        producers[event].eventChannelNumber = event;
+        producers[event].count = count;
+        if (pthread_create(&threads[event], NULL, XcpDaqTest_Producer, &producers[event]) != 0) {
+            return count;
+        }
+    }
+    while (received < (count * numProducers)) {
+        msg.data = payload;
+        if (!XcpDaq_DequeueMessage(&msg)) {
+            if (blocking) {
+                XcpDaq_WaitForMessages();
+            } else {
+                sched_yield();
+            }
+            continue;
+        }
+        ++received;
+        event = payload[0];
+        if (event >= numProducers) {
+            ++errors;
+            continue;
+        }
+        seq = payload[1] | (payload[2] << 8) | (payload[3] << 16);
+        if ((seq != (expected[event] & 0xffffff)) || (msg.dlc != XcpDaqTest_Dlc(expected[event]))) {
+            ++errors;
+        } else {
+            for (idx = 4; idx < msg.dlc; ++idx) {
+                if (payload[idx] != XcpDaqTest_Byte(seq, idx)) {
+                    ++errors;
+                    break;
+                }
+            }
+        }
+        ++expected[event];
+    }
+    for (event = 0; event < numProducers; ++event) {
+        pthread_join(threads[event], NULL);
+    }
+    return errors + atomic_load(&XcpDaqTest_TimedOutWaits);
+}
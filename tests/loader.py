@@ -5,7 +5,7 @@ import threading
 from xcp_types import (
         Xcp_ReturnType, XcpDaq_ListIntegerType, XcpDaq_ODTIntegerType, XcpDaq_ODTEntryIntegerType,
         XcpDaq_ListConfigurationType, XcpDaq_ListStateType, XcpDaq_ODTEntryType, XcpDaq_EventType,
-        XcpDaq_ProcessorStateType, XcpDaq_ProcessorType, XcpDaq_MessageType, XcpDaq_EntityType
+        XcpDaq_ProcessorStateType, XcpDaq_ProcessorType, XcpDaq_MessageType
     )
 
 
@@ -0,0 +1,87 @@
+/*
+ * Gather plan test: a producer thread keeps triggering an event channel while the calling
+ * thread starts and stops one of its DAQ lists `count` times; returns the number of malformed DTOs.
+ *
+ * DAQ list 0 must sample `values[0..1]` into PID 0, DAQ list 1 `values[0..5]` into PID 1,
+ * both with PID and without timestamp; list 1 is running, list 0 is stopped -- toggling list 0
+ * moves the ODT of list 1 within the gather plan.
+ */
+
+#include <pthread.h>
+#include <stdatomic.h>
+
+#include "xcp.h"
+
+typedef struct tagXcpDaqTest_ProducerType {
+    uint8_t eventChannelNumber;
+    uint8_t const * values;
+    uint32_t errors;
+    atomic_bool stop;
+} XcpDaqTest_ProducerType;
+
+static bool XcpDaqTest_CheckDto(XcpDaqTest_ProducerType const * producer, uint8_t const * payload, uint8_t dlc)
+{
+    uint8_t length;
+    uint8_t idx;
+
+    if (payload[0] == 0) {
+        length = 2;
+    } else if (payload[0] == 1) {
+        length = 6;
+    } else {
+        return false;
+    }
+    if (dlc != (length + 1)) {
+        return false;
+    }
+    for (idx = 0; idx < length; ++idx) {
+        if (payload[idx + 1] != producer->values[idx]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void * XcpDaqTest_Producer(void * arg)
+{
+    XcpDaqTest_ProducerType * producer = (XcpDaqTest_ProducerType *)arg;
+    uint8_t payload[XCP_MAX_DTO];
+    XcpDaq_MessageType msg;
+
+    while (!atomic_load(&producer->stop)) {
+        XcpDaq_TriggerEvent(producer->eventChannelNumber);
+        msg.data = payload;
+        while (XcpDaq_DequeueMessage(&msg)) {
+            if (!XcpDaqTest_CheckDto(producer, payload, msg.dlc)) {
+                ++producer->errors;
+            }
+        }
+    }
+    return NULL;
+}
+
+uint32_t XcpDaqTest_PlanStress(uint8_t eventChannelNumber, uint8_t const * values, uint32_t count)
+{
+    pthread_t thread;
+    XcpDaqTest_ProducerType producer;
+    uint32_t idx;
+
+    producer.eventChannelNumber = eventChannelNumber;
+    producer.values = values;
+    producer.errors = 0;
+    atomic_init(&producer.stop, false);
+    if (pthread_create(&thread, NULL, XcpDaqTest_Producer, &producer) != 0) {
+        return count;
+    }
+    for (idx = 0; idx < count; ++idx) {
+        XcpDaq_GetListState(0)->mode |= XCP_DAQ_LIST_MODE_SELECTED;
+        if ((idx & 1) == 0) {
+            (void)XcpDaq_StartSelectedLists();
+        } else {
+            (void)XcpDaq_StopSelectedLists();
+        }
+    }
+    atomic_store(&producer.stop, true);
+    pthread_join(thread, NULL);
+    return producer.errors;
+}
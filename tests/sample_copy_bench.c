@@ -0,0 +1,76 @@
+/*
+ * Micro-benchmark: XcpUtl_SampleCopy vs. the byte loop of XcpUtl_MemCopy.
+ *
+ * Copies a typical ODT (mix of aligned 1/2/4/8 byte signals plus one coalesced run)
+ * into a DTO buffer `iterations` times; see bench_sample_copy.py.
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <time.h>
+
+#include "xcp.h"
+
+#define XCP_UTL_BENCH_DTO_SIZE  (64)
+
+typedef void (*XcpUtlBench_CopyType)(void * dst, void const * src, uint32_t len);
+
+typedef struct tagXcpUtlBench_EntryType {
+    uint16_t source;
+    uint16_t offset;
+    uint16_t length;
+} XcpUtlBench_EntryType;
+
+static uint64_t XcpUtlBench_Signals[XCP_UTL_BENCH_DTO_SIZE];
+static uint8_t XcpUtlBench_Dto[XCP_UTL_BENCH_DTO_SIZE];
+
+static uint64_t XcpUtlBench_Now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static uint64_t XcpUtlBench_Run(XcpUtlBench_CopyType copy, XcpUtlBench_EntryType const * entries, uint16_t numEntries, uint32_t iterations)
+{
+    uint8_t const * base = (uint8_t const *)&XcpUtlBench_Signals[0];
+    uint64_t start = XcpUtlBench_Now();
+    uint32_t iter;
+    uint16_t idx;
+
+    for (iter = 0; iter < iterations; ++iter) {
+        for (idx = 0; idx < numEntries; ++idx) {
+            copy(&XcpUtlBench_Dto[entries[idx].offset], base + entries[idx].source, entries[idx].length);
+        }
+        __asm__ __volatile__("" : : "r"(XcpUtlBench_Dto) : "memory");
+    }
+    return XcpUtlBench_Now() - start;
+}
+
+/*
+ * Returns the elapsed nanoseconds of the byte loop and the kernel for `iterations` ODTs;
+ * `width` 0 uses the mixed ODT, 1/2/4/8 an ODT made of signals of that width only.
+ */
+void XcpUtlBench_SampleCopy(uint8_t width, uint32_t iterations, uint64_t * byteLoopNs, uint64_t * kernelNs)
+{
+    static const XcpUtlBench_EntryType mixed[] = {
+        {0, 1, 4}, {8, 5, 2}, {16, 7, 1}, {24, 8, 8}, {32, 16, 4}, {40, 20, 2}, {48, 22, 2}, {64, 24, 32},
+    };
+    XcpUtlBench_EntryType uniform[XCP_UTL_BENCH_DTO_SIZE];
+    XcpUtlBench_EntryType const * entries = mixed;
+    uint16_t numEntries = (uint16_t)(sizeof(mixed) / sizeof(mixed[0]));
+    uint16_t idx;
+
+    if (width != 0) {
+        numEntries = (uint16_t)((XCP_UTL_BENCH_DTO_SIZE - 1) / width);
+        for (idx = 0; idx < numEntries; ++idx) {
+            uniform[idx].source = (uint16_t)(idx * 8);
+            uniform[idx].offset = (uint16_t)(1 + idx * width);
+            uniform[idx].length = width;
+        }
+        entries = uniform;
+    }
+    *byteLoopNs = XcpUtlBench_Run(XcpUtl_MemCopy, entries, numEntries, iterations);
+    *kernelNs = XcpUtlBench_Run(XcpUtl_SampleCopy, entries, numEntries, iterations);
+}
@@ -0,0 +1,66 @@
+/*
+ * Sequence lock test: a writer thread keeps two measurement variables complementary
+ * while the calling thread samples them through a DAQ list of the given event channel;
+ * returns the number of inconsistent DTOs.
+ *
+ * The DAQ list must sample `values[0]` and `values[4]` (two bytes each) into one ODT with PID.
+ */
+
+#include <pthread.h>
+#include <stdatomic.h>
+
+#include "xcp.h"
+
+typedef struct tagXcpDaqTest_WriterType {
+    XcpDaq_SeqLockType * lock;
+    uint16_t volatile * values;
+    atomic_bool stop;
+} XcpDaqTest_WriterType;
+
+static void * XcpDaqTest_Writer(void * arg)
+{
+    XcpDaqTest_WriterType * writer = (XcpDaqTest_WriterType *)arg;
+    uint16_t value = 0;
+
+    while (!atomic_load(&writer->stop)) {
+        ++value;
+        XcpDaq_SeqLockWriteBegin(writer->lock);
+        writer->values[0] = value;
+        writer->values[4] = UINT16(~value);
+        XcpDaq_SeqLockWriteEnd(writer->lock);
+    }
+    return NULL;
+}
+
+uint32_t XcpDaqTest_SeqLockStress(uint8_t eventChannelNumber, uint16_t * values, XcpDaq_SeqLockType * lock, uint32_t count)
+{
+    pthread_t thread;
+    XcpDaqTest_WriterType writer;
+    uint8_t payload[XCP_MAX_DTO];
+    XcpDaq_MessageType msg;
+    uint32_t errors = 0;
+    uint32_t idx;
+    uint16_t first;
+    uint16_t second;
+
+    writer.lock = lock;
+    writer.values = values;
+    atomic_init(&writer.stop, false);
+    if (pthread_create(&thread, NULL, XcpDaqTest_Writer, &writer) != 0) {
+        return count;
+    }
+    for (idx = 0; idx < count; ++idx) {
+        XcpDaq_TriggerEvent(eventChannelNumber);
+        msg.data = payload;
+        while (XcpDaq_DequeueMessage(&msg)) {
+            first = UINT16(payload[1] | (payload[2] << 8));
+            second = UINT16(payload[3] | (payload[4] << 8));
+            if ((msg.dlc != 5) || (first != UINT16(~second))) {
+                ++errors;
+            }
+        }
+    }
+    atomic_store(&writer.stop, true);
+    pthread_join(thread, NULL);
+    return errors;
+}
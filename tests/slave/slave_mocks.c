@@ -0,0 +1,245 @@
+/*
+ * Environment of test_slave.so: a transport layer recording the frames it is asked to send,
+ * a hardware layer with a fixed measurement area below 4GB, and the predefined DAQ lists.
+ * Remote memory is provided by src/hw/linux/remote.c.
+ */
+
+#include <sys/mman.h>
+
+#include "xcp.h"
+
+/* ODT entry addresses are 32 bits wide. */
+#define XCPSLAVE_MEASUREMENT_AREA   UINT32(0x21000000)
+#define XCPSLAVE_MEASUREMENT_SIZE   UINT32(4096)
+
+#define XCPSLAVE_MEASUREMENT(type, offset)  (*(type *)(uintptr_t)(XCPSLAVE_MEASUREMENT_AREA + UINT32(offset)))
+
+/* MTAs are 32 bits wide as well, so uploads and downloads need PDU buffers behind the measurements. */
+#define XCPSLAVE_PDU_IN             ((uint8_t *)(uintptr_t)(XCPSLAVE_MEASUREMENT_AREA + XCPSLAVE_MEASUREMENT_SIZE))
+#define XCPSLAVE_PDU_OUT            (XCPSLAVE_PDU_IN + XCP_MAX_CTO)
+#define XCPSLAVE_MAPPING_SIZE       (XCPSLAVE_MEASUREMENT_SIZE + UINT32(4096))
+
+/* Calibration page window, mapped onto one of the pages within the measurement area. */
+#define XCPSLAVE_PAGE_WINDOW        UINT32(0x30000000)
+#define XCPSLAVE_PAGE_SIZE          UINT32(256)
+
+#define XCPSLAVE_MAX_FRAMES         (64)
+
+static uint8_t XcpSlave_PduOutBuffer[XCP_MAX_CTO + XCP_TRANSPORT_LAYER_BUFFER_OFFSET];
+static uint8_t XcpSlave_Frames[XCPSLAVE_MAX_FRAMES][XCP_ON_ETHERNET_FRAME_SIZE];
+static uint16_t XcpSlave_FrameLengths[XCPSLAVE_MAX_FRAMES];
+static uint16_t XcpSlave_FrameCount;
+static uint32_t XcpSlave_Timer;
+static void * XcpSlave_Area = MAP_FAILED;
+static uint32_t XcpSlave_PageOffset;
+
+/*
+**  Predefined DAQ list 0 samples two measurements through a sampler,
+**  list 1 samples the very same ODT entries through the generic gather path.
+*/
+#define XcpSlave_Counter    XCPSLAVE_MEASUREMENT(uint32_t, 0)
+#define XcpSlave_Level      XCPSLAVE_MEASUREMENT(uint16_t, 4)
+
+#define XCPSLAVE_ODT0_ENTRIES(ENTRY)    \
+    ENTRY(XcpSlave_Counter)             \
+    ENTRY(XcpSlave_Level)
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpointer-to-int-cast"  /* Fixed addresses, s. XCPSLAVE_MEASUREMENT_AREA. */
+const XcpDaq_ODTEntryType XcpDaq_PredefinedOdtEntries[] = {
+    XCP_DAQ_DEFINE_ODT_ENTRIES(XCPSLAVE_ODT0_ENTRIES)
+};
+#pragma GCC diagnostic pop
+
+XCP_DAQ_DEFINE_ODT_SAMPLER(XcpSlave_SampleOdt0, XCPSLAVE_ODT0_ENTRIES)
+
+const XcpDaq_OdtSamplerType XcpDaq_PredefinedOdtSamplers[] = {
+    XCP_DAQ_ODT_SAMPLER(XcpSlave_SampleOdt0, XCPSLAVE_ODT0_ENTRIES),
+    XCP_DAQ_NO_ODT_SAMPLER,
+};
+
+const XcpDaq_ODTType XcpDaq_PredefinedOdts[] = {
+    {
+        2, 0
+    },
+    {
+        2, 0
+    },
+};
+
+const XcpDaq_ListConfigurationType XcpDaq_PredefinedLists[] = {
+    {
+        1, 0
+    },
+    {
+        1, 1
+    },
+};
+
+XcpDaq_ListStateType XcpDaq_PredefinedListsState[XCP_DAQ_PREDEFINDED_LIST_COUNT];
+const XcpDaq_ListIntegerType XcpDaq_PredefinedListCount = XCP_DAQ_PREDEFINDED_LIST_COUNT;
+
+XCP_DAQ_BEGIN_EVENTS
+    XCP_DAQ_DEFINE_EVENT("EVT 10ms",
+        XCP_DAQ_EVENT_CHANNEL_TYPE_DAQ | XCP_DAQ_CONSISTENCY_DAQ_LIST,
+        XCP_DAQ_EVENT_CHANNEL_TIME_UNIT_1MS,
+        10
+    ),
+    XCP_DAQ_DEFINE_EVENT("EVT 100ms",
+        XCP_DAQ_EVENT_CHANNEL_TYPE_DAQ | XCP_DAQ_CONSISTENCY_DAQ_LIST,
+        XCP_DAQ_EVENT_CHANNEL_TIME_UNIT_1MS,
+        100
+    ),
+    XCP_DAQ_DEFINE_EVENT("EVT sporadic",
+        XCP_DAQ_EVENT_CHANNEL_TYPE_DAQ | XCP_DAQ_CONSISTENCY_DAQ_LIST,
+        XCP_DAQ_EVENT_CHANNEL_TIME_UNIT_1MS,
+        0
+    ),
+XCP_DAQ_END_EVENTS
+
+/*
+**  Hardware layer.
+*/
+void XcpHw_Init(void)
+{
+    if (XcpSlave_Area == MAP_FAILED) {
+        XcpSlave_Area = mmap((void *)(uintptr_t)XCPSLAVE_MEASUREMENT_AREA, XCPSLAVE_MAPPING_SIZE,
+            PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0
+        );
+    }
+    if (XcpSlave_Area == (void *)(uintptr_t)XCPSLAVE_MEASUREMENT_AREA) {
+        XcpUtl_ZeroMem(XcpSlave_Area, XCPSLAVE_MEASUREMENT_SIZE);
+    }
+    XcpSlave_Timer = UINT32(0);
+    XcpSlave_PageOffset = XCPSLAVE_PAGE_SIZE;
+}
+
+uint32_t XcpHw_GetTimerCounter(void)
+{
+    return XcpSlave_Timer;
+}
+
+/*
+**  Transport layer.
+*/
+void XcpTl_Init(void)
+{
+    if (XcpSlave_Area == (void *)(uintptr_t)XCPSLAVE_MEASUREMENT_AREA) {
+        Xcp_PduOut.data = XCPSLAVE_PDU_OUT;
+    } else {
+        Xcp_PduOut.data = &XcpSlave_PduOutBuffer[0];
+    }
+    XcpSlave_FrameCount = UINT16(0);
+}
+
+void XcpTl_DeInit(void)
+{
+}
+
+void XcpTl_MainFunction(void)
+{
+}
+
+void XcpTl_Send(uint8_t const * buf, uint16_t len)
+{
+    if ((XcpSlave_FrameCount < UINT16(XCPSLAVE_MAX_FRAMES)) && (len <= UINT16(XCP_ON_ETHERNET_FRAME_SIZE))) {
+        XcpUtl_MemCopy(&XcpSlave_Frames[XcpSlave_FrameCount][0], buf, UINT32(len));
+        XcpSlave_FrameLengths[XcpSlave_FrameCount] = len;
+        XcpSlave_FrameCount++;
+    }
+}
+
+void XcpTl_SaveConnection(void)
+{
+}
+
+void XcpTl_ReleaseConnection(void)
+{
+}
+
+bool XcpTl_VerifyConnection(void)
+{
+    return (bool)XCP_TRUE;
+}
+
+void XcpTl_PrintConnectionInformation(void)
+{
+}
+
+/*
+**  Customization functions.
+*/
+bool Xcp_HookFunction_CheckMemoryAccess(Xcp_MtaType mta, uint32_t length, Xcp_MemoryAccessType access, bool programming)
+{
+    return (bool)XCP_TRUE;
+}
+
+Xcp_MemoryMappingResultType Xcp_HookFunction_AddressMapper(Xcp_MtaType * dst, Xcp_MtaType const * src)
+{
+    if ((src->address < XCPSLAVE_PAGE_WINDOW) || (src->address >= (XCPSLAVE_PAGE_WINDOW + XCPSLAVE_PAGE_SIZE))) {
+        return XCP_MEMORY_NOT_MAPPED;
+    }
+    dst->address = XCPSLAVE_MEASUREMENT_AREA + XcpSlave_PageOffset + (src->address - XCPSLAVE_PAGE_WINDOW);
+    dst->ext = src->ext;
+    return XCP_MEMORY_MAPPED;
+}
+
+bool Xcp_HookFunction_GetSeed(uint8_t resource, Xcp_1DArrayType * result)
+{
+    static uint8_t seed[4] = {0};
+
+    result->length = UINT8(4);
+    result->data = &seed[0];
+    return (bool)XCP_TRUE;
+}
+
+bool Xcp_HookFunction_Unlock(uint8_t resource, Xcp_1DArrayType const * key)
+{
+    return (bool)XCP_TRUE;
+}
+
+/*
+**  Test interface.
+*/
+uint8_t * XcpSlave_GetMeasurementArea(void)
+{
+    if (XcpSlave_Area != (void *)(uintptr_t)XCPSLAVE_MEASUREMENT_AREA) {
+        return (uint8_t *)XCP_NULL;  /* Address range taken, tests are skipped. */
+    }
+    return (uint8_t *)XcpSlave_Area;
+}
+
+/** @brief Dispatch a command as received by the transport layer, responses are recorded as frames. */
+void XcpSlave_Command(uint8_t const * data, uint16_t len)
+{
+    uint8_t cmd[XCP_MAX_CTO];
+    Xcp_PDUType pdu;
+
+    pdu.data = (XcpSlave_Area == (void *)(uintptr_t)XCPSLAVE_MEASUREMENT_AREA) ? XCPSLAVE_PDU_IN : &cmd[0];
+    XcpUtl_MemCopy(pdu.data, data, UINT32(len));
+    pdu.len = len;
+    Xcp_DispatchCommand(&pdu);
+}
+
+/** @brief Map the page window onto the page at `offset` within the measurement area, as on a page switch. */
+bool XcpSlave_SwitchPage(uint32_t offset)
+{
+    XcpSlave_PageOffset = offset;
+    return XcpDaq_RemapAddressRange(XCPSLAVE_PAGE_WINDOW, XCPSLAVE_PAGE_SIZE);
+}
+
+uint16_t XcpSlave_GetFrameCount(void)
+{
+    return XcpSlave_FrameCount;
+}
+
+uint8_t const * XcpSlave_GetFrame(uint16_t idx, uint16_t * len)
+{
+    *len = XcpSlave_FrameLengths[idx];
+    return &XcpSlave_Frames[idx][0];
+}
+
+void XcpSlave_ClearFrames(void)
+{
+    XcpSlave_FrameCount = UINT16(0);
+}
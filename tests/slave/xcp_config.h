@@ -0,0 +1,173 @@
+/*
+ * BlueParrot XCP
+ *
+ * (C) 2007-2020 by Christoph Schueler <github.com/Christoph2,
+ *                                      cpu12.gems@googlemail.com>
+ *
+ * All Rights Reserved
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * s. FLOSS-EXCEPTION.txt
+ */
+
+/*
+ *  Configuration of test_slave.so: the complete slave (commands, DAQ processor, framing),
+ *  with predefined DAQ lists in front of dynamic ones, s. slave_mocks.c.
+ *
+ *  For details on options refer to `documentation <https://github.com/christoph2/cxcp/docs/options.rst>`_
+ */
+
+#if !defined(__XCP_CONFIG_H)
+#define __XCP_CONFIG_H
+
+#define XCP_GET_ID_0                                "BlueParrot XCP slave tests"
+#define XCP_GET_ID_1                                "Example_Project"
+
+#define XCP_BUILD_TYPE                              XCP_DEBUG_BUILD
+
+#define XCP_EXTERN_C_GUARDS                         XCP_OFF
+
+#define XCP_ENABLE_SLAVE_BLOCKMODE                  XCP_OFF
+#define XCP_ENABLE_MASTER_BLOCKMODE                 XCP_OFF
+
+#define XCP_ENABLE_STIM                             XCP_OFF
+
+#define XCP_CHECKSUM_METHOD                         XCP_CHECKSUM_METHOD_XCP_CRC_16_CITT
+#define XCP_CHECKSUM_CHUNKED_CALCULATION            XCP_OFF
+#define XCP_CHECKSUM_MAXIMUM_BLOCK_SIZE             (0)     /* 0 ==> unlimited */
+
+#define XCP_BYTE_ORDER                              XCP_BYTE_ORDER_INTEL
+#define XCP_ADDRESS_GRANULARITY                     XCP_ADDRESS_GRANULARITY_BYTE
+
+#define XCP_ENABLE_STATISTICS                       XCP_OFF
+
+#define XCP_MAX_BS                                  (0)
+#define XCP_MIN_ST                                  (0)
+#define XCP_QUEUE_SIZE                              (0)
+
+/*
+ * **  Resource Protection.
+ * */
+#define XCP_PROTECT_CAL                             XCP_OFF
+#define XCP_PROTECT_PAG                             XCP_OFF
+#define XCP_PROTECT_DAQ                             XCP_OFF
+#define XCP_PROTECT_STIM                            XCP_OFF
+#define XCP_PROTECT_PGM                             XCP_OFF
+
+/*
+ * **  DAQ Settings.
+ * */
+#define XCP_DAQ_CONFIG_TYPE                         XCP_DAQ_CONFIG_TYPE_DYNAMIC
+#define XCP_DAQ_DTO_BUFFER_SIZE                     (512)   /* More than a frame's worth of DTOs per event. */
+#define XCP_DAQ_ENABLE_PREDEFINED_LISTS             XCP_ON
+#define XCP_DAQ_ENABLE_PREDEFINED_SAMPLERS          XCP_ON
+#define XCP_DAQ_TIMESTAMP_UNIT                      (XCP_DAQ_TIMESTAMP_UNIT_10US)
+#define XCP_DAQ_TIMESTAMP_SIZE                      (XCP_DAQ_TIMESTAMP_SIZE_4)
+#define XCP_DAQ_ENABLE_PRESCALER                    XCP_ON
+#define XCP_DAQ_ENABLE_ADDR_EXT                     XCP_ON      /* Selects remote memory. */
+#define XCP_DAQ_ENABLE_BIT_OFFSET                   XCP_OFF
+#define XCP_DAQ_ENABLE_PRIORITIZATION               XCP_OFF
+#define XCP_DAQ_OVERLOAD_INDICATION                 XCP_DAQ_OVERLOAD_INDICATION_PID
+#define XCP_DAQ_ENABLE_ALTERNATING                  XCP_OFF
+#define XCP_DAQ_ENABLE_CLOCK_ACCESS_ALWAYS          XCP_ON
+#define XCP_DAQ_ENABLE_WRITE_THROUGH                XCP_ON
+#define XCP_DAQ_MAX_DYNAMIC_ENTITIES                (100)
+#define XCP_DAQ_MAX_EVENT_CHANNEL                   (3)
+#define XCP_DAQ_ENABLE_MULTIPLE_DAQ_LISTS_PER_EVENT XCP_ON
+#define XCP_DAQ_MAX_LISTS_PER_EVENT                 (4)
+#define XCP_DAQ_ENABLE_RESUME                       XCP_OFF
+#define XCP_DAQ_ENABLE_LOCK_FREE_DTO_QUEUE          XCP_ON
+#define XCP_DAQ_ENABLE_TRANSMIT_TASK                XCP_OFF     /* DTOs are sent by Xcp_MainFunction(). */
+
+/*
+ * **  Optional Services.
+ * */
+#define XCP_ENABLE_GET_COMM_MODE_INFO               XCP_ON
+#define XCP_ENABLE_GET_ID                           XCP_OFF
+#define XCP_ENABLE_SET_REQUEST                      XCP_OFF
+#define XCP_ENABLE_GET_SEED                         XCP_ON
+#define XCP_ENABLE_UNLOCK                           XCP_ON
+#define XCP_ENABLE_SET_MTA                          XCP_ON
+#define XCP_ENABLE_UPLOAD                           XCP_ON
+#define XCP_ENABLE_SHORT_UPLOAD                     XCP_ON
+#define XCP_ENABLE_BUILD_CHECKSUM                   XCP_OFF
+#define XCP_ENABLE_TRANSPORT_LAYER_CMD              XCP_OFF
+#define XCP_ENABLE_USER_CMD                         XCP_OFF
+
+#define XCP_ENABLE_CAL_COMMANDS                     XCP_ON
+    #define XCP_ENABLE_DOWNLOAD_NEXT                XCP_OFF
+    #define XCP_ENABLE_DOWNLOAD_MAX                 XCP_OFF
+    #define XCP_ENABLE_SHORT_DOWNLOAD               XCP_ON
+    #define XCP_ENABLE_MODIFY_BITS                  XCP_OFF
+
+#define XCP_ENABLE_PAG_COMMANDS                     XCP_OFF
+
+#define XCP_ENABLE_DAQ_COMMANDS                     XCP_ON
+    #define XCP_ENABLE_GET_DAQ_CLOCK                XCP_ON
+    #define XCP_ENABLE_READ_DAQ                     XCP_OFF
+    #define XCP_ENABLE_GET_DAQ_PROCESSOR_INFO       XCP_ON
+    #define XCP_ENABLE_GET_DAQ_RESOLUTION_INFO      XCP_ON
+    #define XCP_ENABLE_GET_DAQ_LIST_INFO            XCP_ON
+    #define XCP_ENABLE_GET_DAQ_EVENT_INFO           XCP_ON
+    #define XCP_ENABLE_FREE_DAQ                     XCP_ON
+    #define XCP_ENABLE_ALLOC_DAQ                    XCP_ON
+    #define XCP_ENABLE_ALLOC_ODT                    XCP_ON
+    #define XCP_ENABLE_ALLOC_ODT_ENTRY              XCP_ON
+    #define XCP_ENABLE_WRITE_DAQ_MULTIPLE           XCP_ON  /* Seven elements per CTO. */
+
+#define XCP_ENABLE_PGM_COMMANDS                     XCP_OFF
+
+/*
+ * **  Transport-Layer specific Options.
+ * */
+#define XCP_TRANSPORT_LAYER                         XCP_ON_ETHERNET
+#define XCP_MAX_CTO                                 (64)
+#define XCP_MAX_DTO                                 (64)
+#define XCP_TRANSPORT_LAYER_LENGTH_SIZE             (2)
+#define XCP_TRANSPORT_LAYER_COUNTER_SIZE            (2)
+#define XCP_TRANSPORT_LAYER_CHECKSUM_SIZE           (0)
+#define XCP_ON_ETHERNET_ENABLE_FRAME_BATCHING       XCP_ON
+#define XCP_ON_ETHERNET_FRAME_SIZE                  (256)
+#define XCP_ON_ETHERNET_FLUSH_DEADLINE              (0)     /* Send as soon as the DTO queues run empty. */
+
+/*
+ * **  Customization Options.
+ * */
+#define XCP_ENABLE_ADDRESS_MAPPER                   XCP_ON
+#define XCP_ENABLE_CHECK_MEMORY_ACCESS              XCP_ON
+#define XCP_ENABLE_REMOTE_MEMORY                    XCP_ON      /* Address extension 0x01. */
+#define XCP_REPLACE_STD_COPY_MEMORY                 XCP_OFF
+#define XCP_ENABLE_GET_ID_HOOK                      XCP_OFF
+
+/*
+ * **  Platform Specific Options.
+ * */
+#define XCP_ENTER_CRITICAL()
+#define XCP_LEAVE_CRITICAL()
+#define XCP_TL_ENTER_CRITICAL()
+#define XCP_TL_LEAVE_CRITICAL()
+#define XCP_DAQ_ENTER_CRITICAL()
+#define XCP_DAQ_LEAVE_CRITICAL()
+#define XCP_STIM_ENTER_CRITICAL()
+#define XCP_STIM_LEAVE_CRITICAL()
+#define XCP_PGM_ENTER_CRITICAL()
+#define XCP_PGM_LEAVE_CRITICAL()
+#define XCP_CAL_ENTER_CRITICAL()
+#define XCP_CAL_LEAVE_CRITICAL()
+#define XCP_PAG_ENTER_CRITICAL()
+#define XCP_PAG_LEAVE_CRITICAL()
+
+#endif /* __XCP_CONFIG_H */
@@ -0,0 +1,126 @@
+
+import ctypes
+import struct
+
+from loader import API, Function
+
+from xcp_types import Xcp_ReturnType
+
+
+class Command:
+    CONNECT                 = 0xFF
+    SET_MTA                 = 0xF6
+    SHORT_UPLOAD            = 0xF4
+    DOWNLOAD                = 0xF0
+    SHORT_DOWNLOAD          = 0xED
+    SET_DAQ_PTR             = 0xE2
+    WRITE_DAQ               = 0xE1
+    SET_DAQ_LIST_MODE       = 0xE0
+    START_STOP_DAQ_LIST     = 0xDE
+    START_STOP_SYNCH        = 0xDD
+    FREE_DAQ                = 0xD6
+    ALLOC_DAQ               = 0xD5
+    ALLOC_ODT               = 0xD4
+    ALLOC_ODT_ENTRY         = 0xD3
+    WRITE_DAQ_MULTIPLE      = 0xC7
+
+
+class Slave(API):
+    """test_slave.so: the complete slave, fed with commands and recording the frames it sends.
+    """
+    FUNCTIONS = (
+        Function("Xcp_Init"),
+        Function("Xcp_MainFunction"),
+        Function("XcpDaq_TriggerEvent", None, [ctypes.c_uint16]),
+        Function("XcpSlave_GetMeasurementArea", ctypes.c_void_p),
+        Function("XcpDaq_RemapAddressRange", ctypes.c_bool, [ctypes.c_uint32, ctypes.c_uint32]),
+        Function("XcpSlave_SwitchPage", ctypes.c_bool, [ctypes.c_uint32]),
+        Function("XcpSlave_Command", None, [ctypes.c_char_p, ctypes.c_uint16]),
+        Function("XcpSlave_GetFrameCount", ctypes.c_uint16),
+        Function("XcpSlave_GetFrame", ctypes.POINTER(ctypes.c_uint8), [ctypes.c_uint16, ctypes.POINTER(ctypes.c_uint16)]),
+        Function("XcpSlave_ClearFrames"),
+        Function("XcpHw_SetRemoteProcess", None, [ctypes.c_int32, ctypes.c_size_t]),
+        Function("XcpDaq_GetRemoteReadErrors", ctypes.c_uint32, [ctypes.c_uint16]),
+        Function("XcpDaq_GetEventOverruns", ctypes.c_uint32, [ctypes.c_uint16]),
+    )
+
+    def frames(self):
+        """Frames sent since the last call, as bytes."""
+        result = []
+        length = ctypes.c_uint16()
+        for idx in range(self.XcpSlave_GetFrameCount()):
+            frame = self.XcpSlave_GetFrame(idx, ctypes.byref(length))
+            result.append(bytes(frame[: length.value]))
+        self.XcpSlave_ClearFrames()
+        return result
+
+    @staticmethod
+    def packets(frame):
+        """Split a frame into (counter, payload) of its packets."""
+        result = []
+        offset = 0
+        while offset < len(frame):
+            length, counter = struct.unpack_from("<HH", frame, offset)
+            offset += 4
+            result.append((counter, frame[offset : offset + length]))
+            offset += length
+        return result
+
+    def command(self, cmd, *data):
+        """Send a command; returns the payload of its response."""
+        pdu = bytes((cmd, ) + data)
+        self.XcpSlave_Command(pdu, len(pdu))
+        packets = [payload for frame in self.frames() for _, payload in self.packets(frame)]
+        assert packets, "no response"
+        return packets[-1]
+
+    def ok(self, cmd, *data):
+        response = self.command(cmd, *data)
+        assert response[0] == 0xFF, "error 0x{:02x}".format(response[1])
+        return response
+
+    def error(self, cmd, *data):
+        response = self.command(cmd, *data)
+        assert response[0] == 0xFE
+        return Xcp_ReturnType(response[1])
+
+    def short_upload(self, length, address, ext = 0):
+        return self.ok(Command.SHORT_UPLOAD, length, 0, ext, *struct.pack("<I", address))[1 : ]
+
+    def short_download(self, address, data, ext = 0):
+        return self.ok(Command.SHORT_DOWNLOAD, len(data), 0, ext, *struct.pack("<I", address), *data)
+
+    def set_daq_ptr(self, daq_list, odt, odt_entry):
+        return self.ok(Command.SET_DAQ_PTR, 0, *struct.pack("<HBB", daq_list, odt, odt_entry))
+
+    def write_daq(self, size, address, bit_offset = 0xff, ext = 0):
+        return self.ok(Command.WRITE_DAQ, bit_offset, size, ext, *struct.pack("<I", address))
+
+    @staticmethod
+    def daq_element(size, address, bit_offset = 0xff, ext = 0):
+        """One element of WRITE_DAQ_MULTIPLE."""
+        return struct.pack("<BBIBx", bit_offset, size, address, ext)
+
+    def write_daq_multiple(self, *elements, count = None):
+        """WRITE_DAQ_MULTIPLE of (size, address) elements; returns the response."""
+        data = b"".join(self.daq_element(size, address) for size, address in elements)
+        return self.command(Command.WRITE_DAQ_MULTIPLE, len(elements) if count is None else count, *data)
+
+    def set_daq_list_mode(self, daq_list, event, mode = 0, prescaler = 1, priority = 0):
+        return self.ok(Command.SET_DAQ_LIST_MODE, mode, *struct.pack("<HHBB", daq_list, event, prescaler, priority))
+
+    def select(self, daq_list):
+        """START_STOP_DAQ_LIST(select); returns the first PID of the list."""
+        return self.ok(Command.START_STOP_DAQ_LIST, 2, *struct.pack("<H", daq_list))[1]
+
+    def start_selected(self):
+        return self.ok(Command.START_STOP_SYNCH, 1)
+
+    def stop_all(self):
+        return self.ok(Command.START_STOP_SYNCH, 0)
+
+    def trigger(self, event):
+        """Trigger an event channel and send the resulting DTOs; returns their payloads."""
+        self.XcpDaq_TriggerEvent(event)
+        self.Xcp_MainFunction()
+        return [payload for frame in self.frames() for _, payload in self.packets(frame)]
@@ -21,8 +21,9 @@ from xcp_if import XCP
 from xcp_types import (
     Xcp_ReturnType, XcpDaq_ListIntegerType, XcpDaq_ODTIntegerType, XcpDaq_ODTEntryIntegerType,
     XcpDaq_ListConfigurationType, XcpDaq_ListStateType, XcpDaq_ODTEntryType, XcpDaq_EventType,
-    XcpDaq_ProcessorStateType, XcpDaq_ProcessorType, XcpDaq_MessageType, XcpDaq_EntityType,
-    XcpDaq_EntityKindType
+    XcpDaq_ProcessorStateType, XcpDaq_ProcessorType, XcpDaq_MessageType, XcpDaq_DynamicListType,
+    XcpDaq_ODTType, XcpDaq_ListMode, XcpDaq_QueueStatisticsType, XcpDaq_StimLatencyType,
+    XcpDaq_SeqLockType
 )
 
 def libname(name):
@@ -49,27 +50,19 @@ def xcp():
     del xcp
 
 
-def xcpdaq_get_dynamic_entity_content(xcp, num):
-    addr = xcp.XcpDaq_GetDynamicEntity(num)
-    entry = ctypes.cast(addr, ctypes.POINTER(XcpDaq_EntityType))
-    kind = entry.contents.kind
-    entity = entry.contents.entity
-
-    # Function is polymorphic on return.
-    if kind == XcpDaq_EntityKindType.XCP_ENTITY_UNUSED:
-        result = None
-    elif kind == XcpDaq_EntityKindType.XCP_ENTITY_DAQ_LIST:
-        result = entity.daqList
-    elif kind == XcpDaq_EntityKindType.XCP_ENTITY_ODT:
-        result = entity.odt
-    elif kind == XcpDaq_EntityKindType.XCP_ENTITY_ODT_ENTRY:
-        result = entity.odtEntry
-    return XcpDaq_EntityKindType(kind), result
-
-def xcpdaq_check_entries_are_unused(xcp, start_idx: int = 0):
-    for idx in range(start_idx, xcp.XcpDaq_TotalDynamicEntityCount()):
-        ent = xcpdaq_get_dynamic_entity_content(xcp, idx)
-        assert ent == (XcpDaq_EntityKindType.XCP_ENTITY_UNUSED, None)
+DYNAMIC_MEMORY_SIZE = MAX_DAQ_ENTITIES * 16
+LIST_SIZE = ctypes.sizeof(XcpDaq_DynamicListType)
+ODT_SIZE = ctypes.sizeof(XcpDaq_ODTType)
+ODT_ENTRY_SIZE = ctypes.sizeof(XcpDaq_ODTEntryType)
+
+def arena_fits(lists, odts = 0, entries = 0):
+    """Model of the dynamic DAQ arena: three dense arrays, each starting 4-byte aligned."""
+    used = 0
+    for count, size in ((lists, LIST_SIZE), (odts, ODT_SIZE), (entries, ODT_ENTRY_SIZE)):
+        used = ((used + 3) & ~3) + count * size
+        if used > DYNAMIC_MEMORY_SIZE:
+            return False
+    return True
 
 ##
 ## Test XcpDaq_AllocTransitionTable
@@ -85,14 +78,11 @@ def test_allocodt_entry_seq_err(xcp):
     assert xcp.XcpDaq_AllocOdtEntry(0, 1, 2) == Xcp_ReturnType.ERR_SEQUENCE
 
 def test_alloc_ok(xcp):
-    xcpdaq_check_entries_are_unused(xcp)
+    assert xcp.get_dynamic_memory() == (0, DYNAMIC_MEMORY_SIZE)
     assert xcp.XcpDaq_Alloc(5) == Xcp_ReturnType.ERR_SUCCESS
-    #ec, _, _ = xcp.get_daq_counts()
-    #for idx in range(0, ec):
-    #    state, ent = xcp.XcpDaq_TotalDynamicEntityCount()
-    #    print("ENT", state, ent.numOdts, ent.firstOdt, ent.mode)
-
-    xcpdaq_check_entries_are_unused(xcp, 5)
+    assert xcp.get_dynamic_memory() == (5 * LIST_SIZE, DYNAMIC_MEMORY_SIZE)
+    xcp.XcpDaq_Free()
+    assert xcp.get_dynamic_memory() == (0, DYNAMIC_MEMORY_SIZE)
 
 def test_allocodt_ok(xcp):
     assert xcp.XcpDaq_Alloc(1) == Xcp_ReturnType.ERR_SUCCESS
@@ -119,7 +109,7 @@ def test_free_ok3(xcp):
 def test_free_ok4(xcp):
     assert xcp.XcpDaq_Alloc(1) == Xcp_ReturnType.ERR_SUCCESS
     assert xcp.XcpDaq_AllocOdt(0, 1) == Xcp_ReturnType.ERR_SUCCESS
-    assert xcp.XcpDaq_AllocOdtEntry(0, 1, 1) == Xcp_ReturnType.ERR_SUCCESS
+    assert xcp.XcpDaq_AllocOdtEntry(0, 0, 1) == Xcp_ReturnType.ERR_SUCCESS
     assert xcp.XcpDaq_Free() == Xcp_ReturnType.ERR_SUCCESS
 
 def test_alloc_aftera_alloc(xcp):
@@ -162,13 +152,28 @@ def test_alloc_out_of_mem(xcp):
     assert xcp.XcpDaq_Alloc(101) == Xcp_ReturnType.ERR_MEMORY_OVERFLOW
 
 def test_allocodt_out_of_mem(xcp):
-    assert xcp.XcpDaq_Alloc(1) == Xcp_ReturnType.ERR_SUCCESS
-    assert xcp.XcpDaq_AllocOdt(0, MAX_DAQ_ENTITIES) == Xcp_ReturnType.ERR_MEMORY_OVERFLOW
+    lists = 90
+    odts = (DYNAMIC_MEMORY_SIZE - lists * LIST_SIZE) // ODT_SIZE
+    assert xcp.XcpDaq_Alloc(lists) == Xcp_ReturnType.ERR_SUCCESS
+    assert xcp.XcpDaq_AllocOdt(0, odts) == Xcp_ReturnType.ERR_SUCCESS
+    assert xcp.XcpDaq_AllocOdt(1, 1) == Xcp_ReturnType.ERR_MEMORY_OVERFLOW
+    assert xcp.get_dynamic_memory() == (DYNAMIC_MEMORY_SIZE, DYNAMIC_MEMORY_SIZE)
 
 def test_allocodt_entry_out_of_mem(xcp):
+    entries = (DYNAMIC_MEMORY_SIZE - LIST_SIZE - 2 * ODT_SIZE) // ODT_ENTRY_SIZE
     assert xcp.XcpDaq_Alloc(1) == Xcp_ReturnType.ERR_SUCCESS
     assert xcp.XcpDaq_AllocOdt(0, 2) == Xcp_ReturnType.ERR_SUCCESS
-    assert xcp.XcpDaq_AllocOdtEntry(0, 1, MAX_DAQ_ENTITIES) == Xcp_ReturnType.ERR_MEMORY_OVERFLOW
+    assert xcp.XcpDaq_AllocOdtEntry(0, 0, entries) == Xcp_ReturnType.ERR_SUCCESS
+    assert xcp.XcpDaq_AllocOdtEntry(0, 1, 1) == Xcp_ReturnType.ERR_MEMORY_OVERFLOW
+    # Typed arrays hold far more ODT entries than the former one-size-fits-all entities.
+    assert entries > MAX_DAQ_ENTITIES
+    assert xcp.get_daq_counts() == (1 + 2 + entries, 1, 2)
+
+def test_alloc_out_of_range(xcp):
+    assert xcp.XcpDaq_Alloc(1) == Xcp_ReturnType.ERR_SUCCESS
+    assert xcp.XcpDaq_AllocOdt(1, 1) == Xcp_ReturnType.ERR_OUT_OF_RANGE
+    assert xcp.XcpDaq_AllocOdt(0, 1) == Xcp_ReturnType.ERR_SUCCESS
+    assert xcp.XcpDaq_AllocOdtEntry(0, 1, 1) == Xcp_ReturnType.ERR_OUT_OF_RANGE
 
 ##
 ##
@@ -196,7 +201,7 @@ def test_basic_alloc3(xcp):
 @given(num = daq_entity_int)
 @settings(max_examples = 1000)
 def test_hy_alloc(xcp, num):
-    if num > MAX_DAQ_ENTITIES:
+    if not arena_fits(num):
         assert xcp.XcpDaq_Alloc(num) == Xcp_ReturnType.ERR_MEMORY_OVERFLOW
         count = 0
     else:
@@ -212,7 +217,7 @@ def test_hy_alloc(xcp, num):
 @example(0, 0, 0)
 #@settings(verbosity = Verbosity.verbose)
 def test_hy_alloc_odt_entities(xcp, n0, n1, n2):
-    if n0 > MAX_DAQ_ENTITIES:
+    if not arena_fits(n0):
         assert xcp.XcpDaq_Alloc(n0) == Xcp_ReturnType.ERR_MEMORY_OVERFLOW
     else:
         assert xcp.XcpDaq_Alloc(n0) == Xcp_ReturnType.ERR_SUCCESS
@@ -221,7 +226,7 @@ def test_hy_alloc_odt_entities(xcp, n0, n1, n2):
             return
         else:
             daq_list = choose(n0)
-        if (n0 + n1) > MAX_DAQ_ENTITIES:
+        if not arena_fits(n0, n1):
             assert xcp.XcpDaq_AllocOdt(daq_list, n1) == Xcp_ReturnType.ERR_MEMORY_OVERFLOW
         else:
             assert xcp.XcpDaq_AllocOdt(daq_list, n1) == Xcp_ReturnType.ERR_SUCCESS
@@ -229,10 +234,634 @@ def test_hy_alloc_odt_entities(xcp, n0, n1, n2):
                 xcp.XcpDaq_Free()
                 return
             else:
-                daq_list = choose(n0)
                 odt = choose(n1)
-                if (n0 + n1 + n2) > MAX_DAQ_ENTITIES:
-                    assert xcp.XcpDaq_AllocOdtEntry(n0, n1, n2) == Xcp_ReturnType.ERR_MEMORY_OVERFLOW
+                if not arena_fits(n0, n1, n2):
+                    assert xcp.XcpDaq_AllocOdtEntry(daq_list, odt, n2) == Xcp_ReturnType.ERR_MEMORY_OVERFLOW
                 else:
-                    assert xcp.XcpDaq_AllocOdtEntry(n0, n1, n2) == Xcp_ReturnType.ERR_SUCCESS
+                    assert xcp.XcpDaq_AllocOdtEntry(daq_list, odt, n2) == Xcp_ReturnType.ERR_SUCCESS
     xcp.XcpDaq_Free()
+
+def first_pid(xcp, daq_list):
+    pid = XcpDaq_ODTIntegerType(0xff)
+    assert xcp.XcpDaq_GetFirstPid(daq_list, ctypes.byref(pid))
+    return pid.value
+
+def test_first_pids_match_reference_loop(xcp):
+    rnd = random.Random(0x24)
+    for _ in range(200):
+        num_odts = [rnd.randint(0, 5) for _ in range(rnd.randint(1, 30))]
+        assert xcp.XcpDaq_Free() == Xcp_ReturnType.ERR_SUCCESS
+        assert xcp.XcpDaq_Alloc(len(num_odts)) == Xcp_ReturnType.ERR_SUCCESS
+        order = list(range(len(num_odts)))
+        rnd.shuffle(order)          # ALLOC_ODT may address lists in any order.
+        allocated = [0] * len(num_odts)
+        for daq_list in order:
+            assert xcp.XcpDaq_AllocOdt(daq_list, num_odts[daq_list]) == Xcp_ReturnType.ERR_SUCCESS
+            allocated[daq_list] = num_odts[daq_list]
+            probe = rnd.randrange(len(num_odts))   # Queried between allocations, too.
+            assert first_pid(xcp, probe) == sum(allocated[: probe])
+        for daq_list in rnd.sample(range(len(num_odts)), len(num_odts)):
+            reference = sum(xcp.XcpDaq_GetListConfiguration(idx).contents.numOdts for idx in range(daq_list))
+            assert first_pid(xcp, daq_list) == reference == sum(num_odts[: daq_list])
+        pid = XcpDaq_ODTIntegerType(0)
+        assert not xcp.XcpDaq_GetFirstPid(len(num_odts), ctypes.byref(pid))
+
+
+##
+##  Sampling.
+##
+PROT_READ_WRITE = 0x03
+MAP_PRIVATE_ANONYMOUS = 0x22
+
+libc = ctypes.CDLL(None, use_errno = True)
+libc.mmap.restype = ctypes.c_void_p
+libc.mmap.argtypes = [ctypes.c_void_p, ctypes.c_size_t, ctypes.c_int, ctypes.c_int, ctypes.c_int, ctypes.c_long]
+
+_measurement_area = libc.mmap(0x20000000, 4096, PROT_READ_WRITE, MAP_PRIVATE_ANONYMOUS, -1, 0)
+
+def measurement_area():
+    """ODT entry addresses are 32 bits wide, so measurement variables must live below 4GB.
+    """
+    if _measurement_area in (None, ctypes.c_void_p(-1).value) or _measurement_area >= 0x100000000:
+        pytest.skip("no memory below 4GB available")
+    return _measurement_area
+
+def write_odt_entry(xcp, daq_list, odt, odt_entry, address, length):
+    entry = xcp.XcpDaq_GetOdtEntry(daq_list, odt, odt_entry)
+    entry.contents.mta.address = address
+    entry.contents.length = length
+
+def dequeue(xcp):
+    buf = (ctypes.c_uint8 * 64)()
+    msg = XcpDaq_MessageType(0, ctypes.cast(buf, ctypes.POINTER(ctypes.c_uint8)))
+    if not xcp.XcpDaq_DequeueMessage(ctypes.byref(msg)):
+        return None
+    return bytes(buf[: msg.dlc])
+
+def test_message_queue_wraps(xcp):
+    for round in range(10):
+        payload = bytes(range(round, round + 7))
+        data = (ctypes.c_uint8 * len(payload)).from_buffer_copy(payload)
+        msg = XcpDaq_MessageType(len(payload), ctypes.cast(data, ctypes.POINTER(ctypes.c_uint8)))
+        assert xcp.XcpDaq_EnqueueMessage(0, 0, ctypes.byref(msg))
+        assert dequeue(xcp) == payload
+    assert dequeue(xcp) is None
+
+def test_message_queue_overflow(xcp):
+    payload = bytes(range(15))
+    data = (ctypes.c_uint8 * len(payload)).from_buffer_copy(payload)
+    msg = XcpDaq_MessageType(len(payload), ctypes.cast(data, ctypes.POINTER(ctypes.c_uint8)))
+    assert xcp.XcpDaq_EnqueueMessage(0, 0, ctypes.byref(msg))
+    while xcp.XcpDaq_EnqueueMessage(0, 0, ctypes.byref(msg)):
+        pass
+    assert dequeue(xcp) == payload
+    assert xcp.XcpDaq_EnqueueMessage(0, 0, ctypes.byref(msg))
+
+def test_message_queue_reserve_commit_in_place(xcp):
+    base = ctypes.addressof(xcp.XcpDaq_GetDtoBuffer(0, 0).contents)
+    for round in range(50):
+        dlc = 1 + (round % 13)
+        dto = xcp.XcpDaq_ReserveMessage(0, 0, 16)
+        assert dto
+        ctypes.memmove(dto, bytes([round] * dlc), dlc)
+        xcp.XcpDaq_CommitMessage(0, 0, dlc)
+        msg = XcpDaq_MessageType()
+        assert xcp.XcpDaq_PeekMessage(ctypes.byref(msg))
+        address = ctypes.cast(msg.data, ctypes.c_void_p).value
+        # Records are contiguous and handed out without copying.
+        assert address == ctypes.cast(dto, ctypes.c_void_p).value
+        assert base <= address and address + msg.dlc <= base + 64
+        assert bytes(msg.data[: msg.dlc]) == bytes([round] * dlc)
+        xcp.XcpDaq_ReleaseMessage()
+    assert not xcp.XcpDaq_PeekMessage(ctypes.byref(XcpDaq_MessageType()))
+
+def test_main_function_sends_queued_dtos(xcp):
+    sent = xcp.XcpTest_GetSentDtoCount()
+    for event in (0, 2):
+        dto = xcp.XcpDaq_ReserveMessage(event, 0, 3)
+        ctypes.memmove(dto, bytes([event, 0x55, 0xaa]), 3)
+        xcp.XcpDaq_CommitMessage(event, 0, 3)
+    xcp.XcpDaq_MainFunction()
+    assert xcp.XcpTest_GetSentDtoCount() == sent + 2
+    assert bytes(xcp.XcpTest_GetLastSentDto()[:3]) == bytes([0x00, 0x55, 0xaa])
+    assert dequeue(xcp) is None
+
+def test_message_queue_concurrent_producer(xcp):
+    assert xcp.XcpDaqTest_DtoQueueStress(1, 200000, False) == 0
+
+def test_message_queue_concurrent_producers(xcp):
+    assert xcp.XcpDaqTest_DtoQueueStress(3, 100000, False) == 0
+
+def transmit_requests(xcp):
+    signals, waits, pending = ctypes.c_uint32(), ctypes.c_uint32(), ctypes.c_uint32()
+    xcp.XcpDaqTest_GetTransmitRequests(ctypes.byref(signals), ctypes.byref(waits), ctypes.byref(pending))
+    return signals.value, waits.value, pending.value
+
+def test_transmit_task_sleeps_until_enqueue(xcp):
+    assert xcp.XcpDaqTest_DtoQueueStress(3, 100000, True) == 0
+    signals, waits, pending = transmit_requests(xcp)
+    # Every blocking wait was ended by exactly one wake-up, none is left over.
+    assert signals == waits
+    assert pending == 0
+
+def test_transmit_task_not_signalled_while_draining(xcp):
+    xcp.XcpDaqTest_ResetTransmitRequests()
+    data = (ctypes.c_uint8 * 2)(0x11, 0x22)
+    msg = XcpDaq_MessageType(2, ctypes.cast(data, ctypes.POINTER(ctypes.c_uint8)))
+    assert xcp.XcpDaq_EnqueueMessage(0, 0, ctypes.byref(msg))
+    # Returns right away, DTOs are already queued.
+    xcp.XcpDaq_WaitForMessages()
+    assert transmit_requests(xcp) == (0, 0, 0)
+    assert dequeue(xcp) == bytes([0x11, 0x22])
+
+def test_message_queue_merges_by_priority(xcp):
+    # "EVT 10ms" (2) has a higher priority than "EVT 100ms" (0) and "EVT sporadic" (1).
+    for event in (0, 0, 1, 1, 2, 2):
+        payload = bytes([event, xcp.XcpDaq_GetEventConfiguration(event).contents.priority])
+        data = (ctypes.c_uint8 * len(payload)).from_buffer_copy(payload)
+        msg = XcpDaq_MessageType(len(payload), ctypes.cast(data, ctypes.POINTER(ctypes.c_uint8)))
+        assert xcp.XcpDaq_EnqueueMessage(event, 0, ctypes.byref(msg))
+    order = []
+    while True:
+        data = dequeue(xcp)
+        if data is None:
+            break
+        order.append(data[0])
+    assert order == [2, 2, 0, 1, 0, 1]
+
+def test_trigger_event_samples_started_lists(xcp):
+    addr = measurement_area()
+    ctypes.memmove(addr, bytes(range(0x10, 0x20)), 16)
+
+    assert xcp.XcpDaq_Free() == Xcp_ReturnType.ERR_SUCCESS
+    assert xcp.XcpDaq_Alloc(2) == Xcp_ReturnType.ERR_SUCCESS
+    assert xcp.XcpDaq_AllocOdt(0, 2) == Xcp_ReturnType.ERR_SUCCESS
+    assert xcp.XcpDaq_AllocOdt(1, 1) == Xcp_ReturnType.ERR_SUCCESS
+    assert xcp.XcpDaq_AllocOdtEntry(0, 0, 2) == Xcp_ReturnType.ERR_SUCCESS
+    assert xcp.XcpDaq_AllocOdtEntry(0, 1, 1) == Xcp_ReturnType.ERR_SUCCESS
+    assert xcp.XcpDaq_AllocOdtEntry(1, 0, 1) == Xcp_ReturnType.ERR_SUCCESS
+    write_odt_entry(xcp, 0, 0, 0, addr, 2)
+    write_odt_entry(xcp, 0, 0, 1, addr + 8, 1)
+    write_odt_entry(xcp, 0, 1, 0, addr + 4, 4)
+    write_odt_entry(xcp, 1, 0, 0, addr + 12, 1)
+
+    xcp.XcpDaq_AddEventChannel(0, 1)
+    xcp.XcpDaq_AddEventChannel(1, 2)
+    xcp.XcpDaq_GetListState(0).contents.mode = XcpDaq_ListMode.XCP_DAQ_LIST_MODE_SELECTED | XcpDaq_ListMode.XCP_DAQ_LIST_MODE_TIMESTAMP
+    xcp.XcpDaq_GetListState(1).contents.mode = XcpDaq_ListMode.XCP_DAQ_LIST_MODE_SELECTED
+    assert xcp.XcpDaq_StartSelectedLists() == Xcp_ReturnType.ERR_SUCCESS
+    xcp.XcpDaq_SetProcessorState(XcpDaq_ProcessorStateType.XCP_DAQ_STATE_RUNNING)
+
+    xcp.XcpDaq_TriggerEvent(0)
+    assert dequeue(xcp) is None
+    xcp.XcpDaq_TriggerEvent(1)
+    assert dequeue(xcp) == bytes([0x00, 0x01, 0x02, 0x03, 0x04, 0x10, 0x11, 0x18])
+    assert dequeue(xcp) == bytes([0x01, 0x14, 0x15, 0x16, 0x17])
+    assert dequeue(xcp) is None
+
+    ctypes.memmove(addr + 12, b"\xaa", 1)
+    xcp.XcpDaq_TriggerEvent(2)
+    assert dequeue(xcp) == bytes([0x02, 0xaa])
+    assert dequeue(xcp) is None
+
+    xcp.XcpDaq_SetProcessorState(XcpDaq_ProcessorStateType.XCP_DAQ_STATE_STOPPED)
+    xcp.XcpDaq_TriggerEvent(2)
+    assert dequeue(xcp) is None
+
+def test_trigger_events_at_caller_timestamp(xcp):
+    addr = measurement_area()
+    ctypes.memmove(addr, bytes(range(0x20, 0x30)), 16)
+
+    assert xcp.XcpDaq_Free() == Xcp_ReturnType.ERR_SUCCESS
+    assert xcp.XcpDaq_Alloc(2) == Xcp_ReturnType.ERR_SUCCESS
+    assert xcp.XcpDaq_AllocOdt(0, 1) == Xcp_ReturnType.ERR_SUCCESS
+    assert xcp.XcpDaq_AllocOdt(1, 1) == Xcp_ReturnType.ERR_SUCCESS
+    assert xcp.XcpDaq_AllocOdtEntry(0, 0, 1) == Xcp_ReturnType.ERR_SUCCESS
+    assert xcp.XcpDaq_AllocOdtEntry(1, 0, 1) == Xcp_ReturnType.ERR_SUCCESS
+    write_odt_entry(xcp, 0, 0, 0, addr, 2)
+    write_odt_entry(xcp, 1, 0, 0, addr + 4, 1)
+
+    xcp.XcpDaq_AddEventChannel(0, 1)
+    xcp.XcpDaq_AddEventChannel(1, 2)
+    for daq_list in range(2):
+        xcp.XcpDaq_GetListState(daq_list).contents.mode = XcpDaq_ListMode.XCP_DAQ_LIST_MODE_SELECTED | XcpDaq_ListMode.XCP_DAQ_LIST_MODE_TIMESTAMP
+    assert xcp.XcpDaq_StartSelectedLists() == Xcp_ReturnType.ERR_SUCCESS
+    xcp.XcpDaq_SetProcessorState(XcpDaq_ProcessorStateType.XCP_DAQ_STATE_RUNNING)
+
+    # The lower XCP_DAQ_TIMESTAMP_SIZE bytes of the caller's timestamp are transmitted, not XcpHw_GetTimerCounter().
+    xcp.XcpDaq_TriggerEventAt(1, 0x1122334455667788)
+    assert dequeue(xcp) == bytes([0x00, 0x88, 0x77, 0x66, 0x55, 0x20, 0x21])
+    assert dequeue(xcp) is None
+
+    # One instant for several events, unknown ones are skipped.
+    events = (ctypes.c_uint16 * 3)(2, 7, 1)
+    xcp.XcpDaq_TriggerEventsAt(events, 3, 0xaabbccdd)
+    received = sorted([dequeue(xcp), dequeue(xcp)])
+    assert received == [bytes([0x00, 0xdd, 0xcc, 0xbb, 0xaa, 0x20, 0x21]), bytes([0x01, 0xdd, 0xcc, 0xbb, 0xaa, 0x24])]
+    assert dequeue(xcp) is None
+
+    # Event numbers are 16 bits wide, 0x101 is not event #1.
+    xcp.XcpDaq_TriggerEvent(0x101)
+    xcp.XcpDaq_TriggerEventAt(0x102, 0)
+    assert dequeue(xcp) is None
+    xcp.XcpDaq_SetProcessorState(XcpDaq_ProcessorStateType.XCP_DAQ_STATE_STOPPED)
+
+def test_multiple_lists_per_event(xcp):
+    addr = measurement_area()
+    ctypes.memmove(addr, bytes(range(0x40, 0x50)), 16)
+
+    assert xcp.XcpDaq_Free() == Xcp_ReturnType.ERR_SUCCESS
+    assert xcp.XcpDaq_Alloc(5) == Xcp_ReturnType.ERR_SUCCESS
+    for daq_list in range(5):
+        assert xcp.XcpDaq_AllocOdt(daq_list, 1) == Xcp_ReturnType.ERR_SUCCESS
+    for daq_list in range(5):
+        assert xcp.XcpDaq_AllocOdtEntry(daq_list, 0, 1) == Xcp_ReturnType.ERR_SUCCESS
+        write_odt_entry(xcp, daq_list, 0, 0, addr + daq_list, 1)
+
+    # Assigned out of order, sampled in ascending list order.
+    for daq_list in (3, 0, 2, 1):
+        assert xcp.XcpDaq_AddEventChannel(daq_list, 0)
+    assert not xcp.XcpDaq_AddEventChannel(4, 0)     # XCP_DAQ_MAX_LISTS_PER_EVENT exceeded.
+    assert xcp.XcpDaq_AddEventChannel(2, 1)         # Moves list #2 to event #1.
+    assert xcp.XcpDaq_AddEventChannel(4, 0)
+    assert not xcp.XcpDaq_AddEventChannel(4, 3)     # No such event channel.
+
+    for daq_list in range(5):
+        xcp.XcpDaq_GetListState(daq_list).contents.mode = XcpDaq_ListMode.XCP_DAQ_LIST_MODE_SELECTED
+    assert xcp.XcpDaq_StartSelectedLists() == Xcp_ReturnType.ERR_SUCCESS
+    xcp.XcpDaq_SetProcessorState(XcpDaq_ProcessorStateType.XCP_DAQ_STATE_RUNNING)
+
+    xcp.XcpDaq_TriggerEvent(0)
+    assert [dequeue(xcp) for _ in range(4)] == [b"\x00\x40", b"\x01\x41", b"\x03\x43", b"\x04\x44"]
+    assert dequeue(xcp) is None
+    xcp.XcpDaq_TriggerEvent(1)
+    assert dequeue(xcp) == b"\x02\x42"
+    assert dequeue(xcp) is None
+
+def test_prescaler_decimates_lists(xcp):
+    addr = measurement_area()
+    ctypes.memmove(addr, bytes(range(0x60, 0x70)), 16)
+
+    assert xcp.XcpDaq_Free() == Xcp_ReturnType.ERR_SUCCESS
+    assert xcp.XcpDaq_Alloc(2) == Xcp_ReturnType.ERR_SUCCESS
+    for daq_list in range(2):
+        assert xcp.XcpDaq_AllocOdt(daq_list, 1) == Xcp_ReturnType.ERR_SUCCESS
+    for daq_list in range(2):
+        assert xcp.XcpDaq_AllocOdtEntry(daq_list, 0, 1) == Xcp_ReturnType.ERR_SUCCESS
+        write_odt_entry(xcp, daq_list, 0, 0, addr + daq_list, 1)
+        assert xcp.XcpDaq_AddEventChannel(daq_list, 0)
+        state = xcp.XcpDaq_GetListState(daq_list).contents
+        assert state.prescaler == 1
+        state.mode = XcpDaq_ListMode.XCP_DAQ_LIST_MODE_SELECTED
+    xcp.XcpDaq_GetListState(1).contents.prescaler = 3
+    assert xcp.XcpDaq_StartSelectedLists() == Xcp_ReturnType.ERR_SUCCESS
+    xcp.XcpDaq_SetProcessorState(XcpDaq_ProcessorStateType.XCP_DAQ_STATE_RUNNING)
+
+    def sample(events):
+        sampled = []
+        for _ in range(events):
+            xcp.XcpDaq_TriggerEvent(0)
+            while True:
+                data = dequeue(xcp)
+                if data is None:
+                    break
+                sampled.append(data[0])
+        return sampled
+
+    # List #1 is sampled on the 1st, 4th and 7th event only.
+    assert sample(7) == [0, 1, 0, 0, 0, 1, 0, 0, 0, 1]
+
+    # Restarting list #0 recompiles the plan, list #1 keeps its phase.
+    xcp.XcpDaq_GetListState(0).contents.mode |= XcpDaq_ListMode.XCP_DAQ_LIST_MODE_SELECTED
+    assert xcp.XcpDaq_StartSelectedLists() == Xcp_ReturnType.ERR_SUCCESS
+    assert sample(3) == [0, 0, 0, 1]
+
+    # Stopped and started again, it starts over with the first event.
+    xcp.XcpDaq_GetListState(1).contents.mode |= XcpDaq_ListMode.XCP_DAQ_LIST_MODE_SELECTED
+    assert xcp.XcpDaq_StopSelectedLists() == Xcp_ReturnType.ERR_SUCCESS
+    xcp.XcpDaq_GetListState(1).contents.mode |= XcpDaq_ListMode.XCP_DAQ_LIST_MODE_SELECTED
+    assert xcp.XcpDaq_StartSelectedLists() == Xcp_ReturnType.ERR_SUCCESS
+    assert sample(2) == [0, 1, 0]
+
+def queue_statistics(xcp, priority_class):
+    stats = XcpDaq_QueueStatisticsType()
+    xcp.XcpDaq_GetQueueStatistics(priority_class, ctypes.byref(stats))
+    return (stats.depth, stats.dropped)
+
+def test_list_priority_is_drained_first(xcp):
+    addr = measurement_area()
+    ctypes.memmove(addr, bytes(range(0x70, 0x80)), 16)
+
+    assert xcp.XcpDaq_Free() == Xcp_ReturnType.ERR_SUCCESS
+    assert xcp.XcpDaq_Alloc(3) == Xcp_ReturnType.ERR_SUCCESS
+    for daq_list in range(3):
+        assert xcp.XcpDaq_AllocOdt(daq_list, 1) == Xcp_ReturnType.ERR_SUCCESS
+    for daq_list, priority in zip(range(3), (0x00, 0xff, 0x80)):
+        assert xcp.XcpDaq_AllocOdtEntry(daq_list, 0, 1) == Xcp_ReturnType.ERR_SUCCESS
+        write_odt_entry(xcp, daq_list, 0, 0, addr + daq_list, 1)
+        assert xcp.XcpDaq_AddEventChannel(daq_list, 0)
+        state = xcp.XcpDaq_GetListState(daq_list).contents
+        state.mode = XcpDaq_ListMode.XCP_DAQ_LIST_MODE_SELECTED
+        state.priority = priority
+    assert xcp.XcpDaq_StartSelectedLists() == Xcp_ReturnType.ERR_SUCCESS
+    xcp.XcpDaq_SetProcessorState(XcpDaq_ProcessorStateType.XCP_DAQ_STATE_RUNNING)
+
+    xcp.XcpDaq_TriggerEvent(0)
+    xcp.XcpDaq_TriggerEvent(0)
+    depth, dropped = queue_statistics(xcp, 0)
+    assert depth > 0 and dropped == 0
+    assert [dequeue(xcp) for _ in range(6)] == [b"\x01\x71"] * 2 + [b"\x02\x72"] * 2 + [b"\x00\x70"] * 2
+    assert dequeue(xcp) is None
+
+def test_queue_statistics_count_drops(xcp):
+    payload = bytes(range(7))
+    data = (ctypes.c_uint8 * len(payload)).from_buffer_copy(payload)
+    msg = XcpDaq_MessageType(len(payload), ctypes.cast(data, ctypes.POINTER(ctypes.c_uint8)))
+    queued = 0
+    while xcp.XcpDaq_EnqueueMessage(1, 0xff, ctypes.byref(msg)):
+        queued += 1
+    assert not xcp.XcpDaq_EnqueueMessage(1, 0xff, ctypes.byref(msg))
+    depth, dropped = queue_statistics(xcp, 3)
+    assert dropped == 2
+    assert depth > 0 and depth <= 64
+    assert queue_statistics(xcp, 0) == (0, 0)
+    for _ in range(queued):
+        assert dequeue(xcp) == payload
+    assert queue_statistics(xcp, 3) == (0, 2)
+
+def test_adjacent_odt_entries_are_coalesced(xcp):
+    addr = measurement_area()
+    ctypes.memmove(addr, bytes(range(0x80, 0x90)), 16)
+
+    assert xcp.XcpDaq_Free() == Xcp_ReturnType.ERR_SUCCESS
+    assert xcp.XcpDaq_Alloc(1) == Xcp_ReturnType.ERR_SUCCESS
+    assert xcp.XcpDaq_AllocOdt(0, 1) == Xcp_ReturnType.ERR_SUCCESS
+    assert xcp.XcpDaq_AllocOdtEntry(0, 0, 6) == Xcp_ReturnType.ERR_SUCCESS
+    write_odt_entry(xcp, 0, 0, 0, addr + 1, 1)
+    write_odt_entry(xcp, 0, 0, 1, addr + 2, 1)
+    write_odt_entry(xcp, 0, 0, 2, addr + 3, 1)
+    write_odt_entry(xcp, 0, 0, 3, addr + 4, 2)     # Naturally aligned, sampled with a load of its own.
+    write_odt_entry(xcp, 0, 0, 4, addr + 6, 1)     # Doesn't extend the aligned member either.
+    write_odt_entry(xcp, 0, 0, 5, addr + 6, 1)     # Same source again, must be sampled twice.
+    assert xcp.XcpDaq_AddEventChannel(0, 0)
+    xcp.XcpDaq_GetListState(0).contents.mode = XcpDaq_ListMode.XCP_DAQ_LIST_MODE_SELECTED
+    assert xcp.XcpDaq_StartSelectedLists() == Xcp_ReturnType.ERR_SUCCESS
+    assert xcp.XcpDaq_GetGatherEntryCount() == 4
+    xcp.XcpDaq_SetProcessorState(XcpDaq_ProcessorStateType.XCP_DAQ_STATE_RUNNING)
+
+    xcp.XcpDaq_TriggerEvent(0)
+    assert dequeue(xcp) == bytes([0x00, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x86])
+
+def test_overload_is_counted_and_indicated_by_pid_msb(xcp):
+    addr = measurement_area()
+    ctypes.memmove(addr, bytes(range(0x90, 0xa0)), 16)
+
+    assert xcp.XcpDaq_Free() == Xcp_ReturnType.ERR_SUCCESS
+    assert xcp.XcpDaq_Alloc(1) == Xcp_ReturnType.ERR_SUCCESS
+    assert xcp.XcpDaq_AllocOdt(0, 1) == Xcp_ReturnType.ERR_SUCCESS
+    assert xcp.XcpDaq_AllocOdtEntry(0, 0, 1) == Xcp_ReturnType.ERR_SUCCESS
+    write_odt_entry(xcp, 0, 0, 0, addr, 4)
+    assert xcp.XcpDaq_AddEventChannel(0, 2)
+    xcp.XcpDaq_GetListState(0).contents.mode = XcpDaq_ListMode.XCP_DAQ_LIST_MODE_SELECTED
+    assert xcp.XcpDaq_StartSelectedLists() == Xcp_ReturnType.ERR_SUCCESS
+    xcp.XcpDaq_SetProcessorState(XcpDaq_ProcessorStateType.XCP_DAQ_STATE_RUNNING)
+
+    properties = ctypes.c_int8()
+    xcp.XcpDaq_GetProperties(ctypes.byref(properties))
+    assert properties.value & 0x40
+
+    queued = 0
+    while xcp.XcpDaq_GetListOverruns(0) == 0:
+        xcp.XcpDaq_TriggerEvent(2)
+        queued += 1
+    queued -= 1
+    xcp.XcpDaq_TriggerEvent(2)
+    assert xcp.XcpDaq_GetListOverruns(0) == 2
+    assert xcp.XcpDaq_GetEventOverruns(2) == 2
+    assert xcp.XcpDaq_GetEventOverruns(0) == 0
+    for _ in range(queued):
+        assert dequeue(xcp) == bytes([0x00, 0x90, 0x91, 0x92, 0x93])
+    assert dequeue(xcp) is None
+
+    xcp.XcpDaq_TriggerEvent(2)
+    xcp.XcpDaq_TriggerEvent(2)
+    assert dequeue(xcp) == bytes([0x80, 0x90, 0x91, 0x92, 0x93])
+    assert dequeue(xcp) == bytes([0x00, 0x90, 0x91, 0x92, 0x93])
+
+    # Restarting the list clears its counter, the event counter is kept.
+    xcp.XcpDaq_GetListState(0).contents.mode |= XcpDaq_ListMode.XCP_DAQ_LIST_MODE_SELECTED
+    assert xcp.XcpDaq_StartSelectedLists() == Xcp_ReturnType.ERR_SUCCESS
+    assert xcp.XcpDaq_GetListOverruns(0) == 0
+    assert xcp.XcpDaq_GetEventOverruns(2) == 2
+
+def test_stim_data_sets_are_applied_on_event(xcp):
+    addr = measurement_area()
+    ctypes.memset(addr, 0, 16)
+
+    assert xcp.XcpDaq_Free() == Xcp_ReturnType.ERR_SUCCESS
+    assert xcp.XcpDaq_Alloc(1) == Xcp_ReturnType.ERR_SUCCESS
+    assert xcp.XcpDaq_AllocOdt(0, 2) == Xcp_ReturnType.ERR_SUCCESS
+    assert xcp.XcpDaq_AllocOdtEntry(0, 0, 2) == Xcp_ReturnType.ERR_SUCCESS
+    assert xcp.XcpDaq_AllocOdtEntry(0, 1, 1) == Xcp_ReturnType.ERR_SUCCESS
+    write_odt_entry(xcp, 0, 0, 0, addr + 0, 2)
+    write_odt_entry(xcp, 0, 0, 1, addr + 8, 2)
+    write_odt_entry(xcp, 0, 1, 0, addr + 4, 3)
+    assert xcp.XcpDaq_AddEventChannel(0, 1)
+    xcp.XcpDaq_GetListState(0).contents.mode = (
+        XcpDaq_ListMode.XCP_DAQ_LIST_MODE_SELECTED | XcpDaq_ListMode.XCP_DAQ_LIST_MODE_DIRECTION
+    )
+    assert xcp.XcpDaq_StartSelectedLists() == Xcp_ReturnType.ERR_SUCCESS
+    xcp.XcpDaq_SetProcessorState(XcpDaq_ProcessorStateType.XCP_DAQ_STATE_RUNNING)
+
+    xcp.XcpDaq_ReceiveStim(bytes([0x00, 0x11, 0x12, 0x13, 0x14]), 5)
+    xcp.XcpDaq_ReceiveStim(bytes([0x01, 0x21, 0x22, 0x23]), 4)
+    xcp.XcpDaq_ReceiveStim(bytes([0x07, 0xee]), 2)             # Unknown PID.
+    assert ctypes.string_at(addr, 16) == bytes(16)
+    xcp.XcpDaq_TriggerEvent(1)
+    assert ctypes.string_at(addr, 11) == bytes([0x11, 0x12, 0, 0, 0x21, 0x22, 0x23, 0, 0x13, 0x14, 0])
+    # No DTOs are sent for STIM lists.
+    assert dequeue(xcp) is None
+
+    # An incomplete data set isn't applied, the latest complete one wins.
+    ctypes.memset(addr, 0, 16)
+    xcp.XcpDaq_TriggerEvent(1)
+    assert ctypes.string_at(addr, 16) == bytes(16)
+    for first in (0x30, 0x40):
+        xcp.XcpDaq_ReceiveStim(bytes([0x00, first, first + 1, first + 2, first + 3]), 5)
+        xcp.XcpDaq_ReceiveStim(bytes([0x01, first + 4, first + 5, first + 6]), 4)
+    xcp.XcpDaq_ReceiveStim(bytes([0x00, 0x50, 0x51, 0x52, 0x53]), 5)
+    xcp.XcpDaq_TriggerEvent(1)
+    assert ctypes.string_at(addr, 11) == bytes([0x40, 0x41, 0, 0, 0x44, 0x45, 0x46, 0, 0x42, 0x43, 0])
+
+    latency = XcpDaq_StimLatencyType()
+    assert xcp.XcpDaq_GetStimLatency(0, ctypes.byref(latency))
+    assert latency.applied == 2
+    assert latency.last == 0 and latency.max == 0
+    assert not xcp.XcpDaq_GetStimLatency(1, ctypes.byref(latency))
+
+def test_seqlock_event_samples_consistent_snapshots(xcp):
+    addr = measurement_area()
+    ctypes.memset(addr, 0, 16)
+    lock = XcpDaq_SeqLockType()
+
+    assert xcp.XcpDaq_Free() == Xcp_ReturnType.ERR_SUCCESS
+    assert xcp.XcpDaq_Alloc(1) == Xcp_ReturnType.ERR_SUCCESS
+    assert xcp.XcpDaq_AllocOdt(0, 1) == Xcp_ReturnType.ERR_SUCCESS
+    assert xcp.XcpDaq_AllocOdtEntry(0, 0, 2) == Xcp_ReturnType.ERR_SUCCESS
+    write_odt_entry(xcp, 0, 0, 0, addr + 0, 2)
+    write_odt_entry(xcp, 0, 0, 1, addr + 8, 2)
+    assert xcp.XcpDaq_AddEventChannel(0, 0)
+    xcp.XcpDaq_SetEventSeqLock(0, ctypes.byref(lock))
+    try:
+        xcp.XcpDaq_GetListState(0).contents.mode = XcpDaq_ListMode.XCP_DAQ_LIST_MODE_SELECTED
+        assert xcp.XcpDaq_StartSelectedLists() == Xcp_ReturnType.ERR_SUCCESS
+        xcp.XcpDaq_SetProcessorState(XcpDaq_ProcessorStateType.XCP_DAQ_STATE_RUNNING)
+
+        xcp.XcpDaq_SeqLockWriteBegin(ctypes.byref(lock))
+        ctypes.memmove(addr, bytes([0x12, 0x34]), 2)
+        xcp.XcpDaq_TriggerEvent(0)
+        # Write in progress, the event isn't sampled.
+        assert dequeue(xcp) is None
+        assert xcp.XcpDaq_GetSeqLockSkips(0) == 1
+        ctypes.memmove(addr + 8, bytes([0xed, 0xcb]), 2)
+        xcp.XcpDaq_SeqLockWriteEnd(ctypes.byref(lock))
+        assert lock.sequence == 2
+        xcp.XcpDaq_TriggerEvent(0)
+        assert dequeue(xcp) == bytes([0x00, 0x12, 0x34, 0xed, 0xcb])
+
+        assert xcp.XcpDaqTest_SeqLockStress(0, addr, ctypes.byref(lock), 20000) == 0
+    finally:
+        xcp.XcpDaq_SetEventSeqLock(0, None)
+
+def test_lists_skipped_by_prescaler_take_no_snapshot(xcp):
+    addr = measurement_area()
+    lock = XcpDaq_SeqLockType()
+
+    assert xcp.XcpDaq_Free() == Xcp_ReturnType.ERR_SUCCESS
+    assert xcp.XcpDaq_Alloc(1) == Xcp_ReturnType.ERR_SUCCESS
+    assert xcp.XcpDaq_AllocOdt(0, 1) == Xcp_ReturnType.ERR_SUCCESS
+    assert xcp.XcpDaq_AllocOdtEntry(0, 0, 1) == Xcp_ReturnType.ERR_SUCCESS
+    write_odt_entry(xcp, 0, 0, 0, addr, 1)
+    assert xcp.XcpDaq_AddEventChannel(0, 0)
+    xcp.XcpDaq_SetEventSeqLock(0, ctypes.byref(lock))
+    try:
+        state = xcp.XcpDaq_GetListState(0).contents
+        state.prescaler = 2
+        state.mode = XcpDaq_ListMode.XCP_DAQ_LIST_MODE_SELECTED
+        assert xcp.XcpDaq_StartSelectedLists() == Xcp_ReturnType.ERR_SUCCESS
+        xcp.XcpDaq_SetProcessorState(XcpDaq_ProcessorStateType.XCP_DAQ_STATE_RUNNING)
+
+        xcp.XcpDaq_TriggerEvent(0)
+        assert dequeue(xcp) is not None
+        xcp.XcpDaq_SeqLockWriteBegin(ctypes.byref(lock))
+        xcp.XcpDaq_TriggerEvent(0)
+        # Not due, so the write in progress doesn't matter.
+        assert dequeue(xcp) is None
+        assert xcp.XcpDaq_GetSeqLockSkips(0) == 0
+        xcp.XcpDaq_SeqLockWriteEnd(ctypes.byref(lock))
+    finally:
+        xcp.XcpDaq_SetEventSeqLock(0, None)
+
+def test_plans_are_replaced_while_sampling(xcp):
+    addr = measurement_area()
+    ctypes.memmove(addr, bytes(range(0x60, 0x70)), 16)
+
+    assert xcp.XcpDaq_Free() == Xcp_ReturnType.ERR_SUCCESS
+    assert xcp.XcpDaq_Alloc(2) == Xcp_ReturnType.ERR_SUCCESS
+    assert xcp.XcpDaq_AllocOdt(0, 1) == Xcp_ReturnType.ERR_SUCCESS
+    assert xcp.XcpDaq_AllocOdt(1, 1) == Xcp_ReturnType.ERR_SUCCESS
+    assert xcp.XcpDaq_AllocOdtEntry(0, 0, 1) == Xcp_ReturnType.ERR_SUCCESS
+    assert xcp.XcpDaq_AllocOdtEntry(1, 0, 2) == Xcp_ReturnType.ERR_SUCCESS
+    write_odt_entry(xcp, 0, 0, 0, addr, 2)
+    write_odt_entry(xcp, 1, 0, 0, addr, 4)
+    write_odt_entry(xcp, 1, 0, 1, addr + 4, 2)
+    assert xcp.XcpDaq_AddEventChannel(0, 0)
+    assert xcp.XcpDaq_AddEventChannel(1, 0)
+    xcp.XcpDaq_GetListState(1).contents.mode = XcpDaq_ListMode.XCP_DAQ_LIST_MODE_SELECTED
+    assert xcp.XcpDaq_StartSelectedLists() == Xcp_ReturnType.ERR_SUCCESS
+    xcp.XcpDaq_SetProcessorState(XcpDaq_ProcessorStateType.XCP_DAQ_STATE_RUNNING)
+
+    # Every DTO matches the ODT of its PID, no matter which plan was sampled.
+    assert xcp.XcpDaqTest_PlanStress(0, addr, 20000) == 0
+
+def test_plan_change_is_busy_while_the_inactive_plan_is_sampled(xcp):
+    xcp.XcpDaq_EnterPlan(0)
+    try:
+        assert xcp.XcpDaq_StopAllLists() == Xcp_ReturnType.ERR_SUCCESS
+        # Event channel 0 still samples the plan replaced just now.
+        assert xcp.XcpDaq_StopAllLists() == Xcp_ReturnType.ERR_CMD_BUSY
+        assert xcp.XcpDaq_StartSelectedLists() == Xcp_ReturnType.ERR_CMD_BUSY
+        assert xcp.XcpDaq_Free() == Xcp_ReturnType.ERR_CMD_BUSY
+    finally:
+        xcp.XcpDaq_LeavePlan(0)
+    assert xcp.XcpDaq_StopAllLists() == Xcp_ReturnType.ERR_SUCCESS
+    assert xcp.XcpDaq_Free() == Xcp_ReturnType.ERR_SUCCESS
+
+def test_resume_image_restores_and_restarts_lists(xcp):
+    addr = measurement_area()
+    ctypes.memmove(addr, bytes(range(0x10, 0x20)), 16)
+
+    assert xcp.XcpDaq_Free() == Xcp_ReturnType.ERR_SUCCESS
+    assert xcp.XcpDaq_Alloc(2) == Xcp_ReturnType.ERR_SUCCESS
+    assert xcp.XcpDaq_AllocOdt(0, 2) == Xcp_ReturnType.ERR_SUCCESS
+    assert xcp.XcpDaq_AllocOdt(1, 1) == Xcp_ReturnType.ERR_SUCCESS
+    assert xcp.XcpDaq_AllocOdtEntry(0, 0, 2) == Xcp_ReturnType.ERR_SUCCESS
+    assert xcp.XcpDaq_AllocOdtEntry(0, 1, 1) == Xcp_ReturnType.ERR_SUCCESS
+    assert xcp.XcpDaq_AllocOdtEntry(1, 0, 1) == Xcp_ReturnType.ERR_SUCCESS
+    write_odt_entry(xcp, 0, 0, 0, addr + 0, 2)
+    write_odt_entry(xcp, 0, 0, 1, addr + 4, 3)
+    write_odt_entry(xcp, 0, 1, 0, addr + 8, 4)
+    write_odt_entry(xcp, 1, 0, 0, addr + 12, 1)
+    assert xcp.XcpDaq_AddEventChannel(0, 1)
+    assert xcp.XcpDaq_AddEventChannel(1, 0)
+    state = xcp.XcpDaq_GetListState(0).contents
+    state.mode = XcpDaq_ListMode.XCP_DAQ_LIST_MODE_SELECTED
+    state.prescaler = 2
+    state.priority = 1
+
+    image = (ctypes.c_uint8 * 256)()
+    assert xcp.XcpDaq_StoreConfiguration(image, 16, True, 0x1234) == 0
+    length = xcp.XcpDaq_StoreConfiguration(image, 256, True, 0x1234)
+    # Header, two lists, three ODTs, four entries and checksum.
+    assert length == 12 + 2 * 8 + 3 * 2 + 4 * 5 + 2
+    assert xcp.XcpDaq_GetListState(0).contents.mode == 0
+
+    session_id = ctypes.c_uint16()
+    corrupt = (ctypes.c_uint8 * 256).from_buffer_copy(image)
+    corrupt[20] ^= 0x01
+    assert not xcp.XcpDaq_RestoreConfiguration(corrupt, length, ctypes.byref(session_id))
+    assert not xcp.XcpDaq_RestoreConfiguration(image, length - 1, ctypes.byref(session_id))
+
+    xcp.XcpDaq_Init()
+    assert xcp.XcpDaq_GetListCount() == 0
+    assert xcp.XcpDaq_RestoreConfiguration(image, 256, ctypes.byref(session_id))
+    assert session_id.value == 0x1234
+    assert xcp.get_daq_counts() == (9, 2, 3)
+    assert xcp.XcpDaq_GetListState(0).contents.mode == XcpDaq_ListMode.XCP_DAQ_LIST_MODE_STARTED
+    assert xcp.XcpDaq_GetListState(0).contents.prescaler == 2
+    assert xcp.XcpDaq_GetListState(0).contents.priority == 1
+    assert xcp.XcpDaq_GetListState(1).contents.mode == 0
+    entry = xcp.XcpDaq_GetOdtEntry(0, 0, 1).contents
+    assert (entry.mta.address, entry.length) == (addr + 4, 3)
+    entry = xcp.XcpDaq_GetOdtEntry(1, 0, 0).contents
+    assert (entry.mta.address, entry.length) == (addr + 12, 1)
+
+    # Event bindings and the prescaler survive: list #0 is sampled every second event #1.
+    xcp.XcpDaq_TriggerEvent(1)
+    assert dequeue(xcp) == bytes([0x00, 0x10, 0x11, 0x14, 0x15, 0x16])
+    assert dequeue(xcp) == bytes([0x01, 0x18, 0x19, 0x1a, 0x1b])
+    xcp.XcpDaq_TriggerEvent(1)
+    assert dequeue(xcp) is None
+    xcp.XcpDaq_TriggerEvent(0)
+    assert dequeue(xcp) is None
+
+def test_sample_copy_all_widths_and_alignments(xcp):
+    src = (ctypes.c_uint8 * 64).from_buffer_copy(bytes(range(0xa0, 0xe0)))
+    dst = (ctypes.c_uint8 * 64)()
+    for length in range(1, 41):
+        for src_offset in range(8):
+            for dst_offset in range(4):
+                ctypes.memset(dst, 0, 64)
+                xcp.XcpUtl_SampleCopy(ctypes.addressof(dst) + dst_offset, ctypes.addressof(src) + src_offset, length)
+                expected = bytes(dst_offset) + bytes(src[src_offset : src_offset + length])
+                assert bytes(dst[: dst_offset + length + 1]) == expected + b"\x00"
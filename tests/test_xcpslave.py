@@ -0,0 +1,312 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+
+import ctypes
+import struct
+import subprocess
+import sys
+
+import pytest
+
+from slave_if import Command, Slave
+
+from xcp_types import Xcp_ReturnType
+
+DLL_NAME = "./test_slave.so"
+
+dll = ctypes.CDLL(DLL_NAME)
+
+PREDEFINED_LIST = 0     # Counter (uint32) at offset 0, level (uint16) at offset 4, s. slave/slave_mocks.c
+UNSAMPLED_LIST = 1      # Same ODT entries, without a sampler.
+DYNAMIC_LIST = 2
+
+EVENT_10MS = 0
+EVENT_100MS = 1
+
+PAGE_WINDOW = 0x30000000   # Mapped onto the measurement area at the current page offset.
+PAGE_SIZE = 256
+
+REMOTE = 0x01   # XCP_REMOTE_MEMORY_ADDRESS_EXTENSION
+
+# A readable page followed by an inaccessible one; prints the page address, then its first 16 bytes per input line.
+TARGET = """
+import ctypes, sys
+libc = ctypes.CDLL(None)
+libc.mmap.restype = ctypes.c_void_p
+libc.mmap.argtypes = (ctypes.c_void_p, ctypes.c_size_t, ctypes.c_int, ctypes.c_int, ctypes.c_int, ctypes.c_long)
+libc.mprotect.argtypes = (ctypes.c_void_p, ctypes.c_size_t, ctypes.c_int)
+page = libc.mmap(None, 8192, 0x03, 0x22, -1, 0)     # PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS
+libc.mprotect(page + 4096, 4096, 0x00)
+ctypes.memmove(page, bytes(range(256)), 256)
+print(page, flush = True)
+for line in sys.stdin:
+    print(ctypes.string_at(page, 16).hex(), flush = True)
+"""
+
+
+@pytest.fixture
+def slave():
+    slave = Slave(dll)
+    slave.Xcp_Init()
+    if not slave.XcpSlave_GetMeasurementArea():
+        pytest.skip("measurement area below 4GB not available")
+    slave.ok(Command.CONNECT, 0)
+    yield slave
+    del slave
+
+
+@pytest.fixture
+def target(slave):
+    """A child process attached as remote memory; remote addresses are offsets into its page."""
+    process = subprocess.Popen([sys.executable, "-c", TARGET], stdin = subprocess.PIPE, stdout = subprocess.PIPE, text = True)
+    page = int(process.stdout.readline())
+    slave.XcpHw_SetRemoteProcess(process.pid, page)
+    if slave.short_upload(4, 0x10, ext = REMOTE) != bytes((0x10, 0x11, 0x12, 0x13)):
+        pytest.skip("process_vm_readv() not permitted")
+    yield process, page
+    slave.XcpHw_SetRemoteProcess(0, 0)
+    process.kill()
+    process.wait()
+
+
+def target_memory(process):
+    process.stdin.write("\n")
+    process.stdin.flush()
+    return bytes.fromhex(process.stdout.readline())
+
+
+def measurement(slave, fmt, offset, value):
+    struct.pack_into(fmt, (ctypes.c_uint8 * 4096).from_address(slave.XcpSlave_GetMeasurementArea()), offset, value)
+
+
+def dynamic_list(slave, event, entries, ext = 0):
+    """Configure the first dynamic DAQ list as one ODT of (size, address) entries and start it."""
+    slave.ok(Command.FREE_DAQ)
+    slave.ok(Command.ALLOC_DAQ, 0, *struct.pack("<H", 1))
+    slave.ok(Command.ALLOC_ODT, 0, *struct.pack("<HB", DYNAMIC_LIST, 1))
+    slave.ok(Command.ALLOC_ODT_ENTRY, 0, *struct.pack("<HBB", DYNAMIC_LIST, 0, len(entries)))
+    slave.set_daq_ptr(DYNAMIC_LIST, 0, 0)
+    for size, address in entries:
+        slave.write_daq(size, address, ext = ext)
+    slave.set_daq_list_mode(DYNAMIC_LIST, event)
+    pid = slave.select(DYNAMIC_LIST)
+    slave.start_selected()
+    return pid
+
+
+##
+##  Predefined and dynamic DAQ lists.
+##
+def test_free_daq_keeps_predefined_lists_running(slave):
+    area = slave.XcpSlave_GetMeasurementArea()
+    measurement(slave, "<I", 0, 0x11223344)
+    measurement(slave, "<H", 4, 0x5566)
+    measurement(slave, "<H", 8, 0x7788)
+    predefined_dto = bytes((0x00, 0x44, 0x33, 0x22, 0x11, 0x66, 0x55))
+
+    slave.set_daq_list_mode(PREDEFINED_LIST, EVENT_10MS)
+    assert slave.select(PREDEFINED_LIST) == 0
+    slave.start_selected()
+    assert slave.trigger(EVENT_10MS) == [predefined_dto]
+
+    # Reconfiguring the dynamic lists neither stops nor renumbers the running predefined list.
+    slave.ok(Command.FREE_DAQ)
+    assert slave.trigger(EVENT_10MS) == [predefined_dto]
+    slave.ok(Command.ALLOC_DAQ, 0, *struct.pack("<H", 1))
+    assert slave.trigger(EVENT_10MS) == [predefined_dto]
+    assert slave.error(Command.ALLOC_ODT, 0, *struct.pack("<HB", PREDEFINED_LIST, 1)) == Xcp_ReturnType.ERR_OUT_OF_RANGE
+    slave.ok(Command.ALLOC_ODT, 0, *struct.pack("<HB", DYNAMIC_LIST, 1))
+    assert slave.trigger(EVENT_10MS) == [predefined_dto]
+    slave.ok(Command.ALLOC_ODT_ENTRY, 0, *struct.pack("<HBB", DYNAMIC_LIST, 0, 1))
+    assert slave.trigger(EVENT_10MS) == [predefined_dto]
+
+    # Dynamic lists are configured while DAQ is stopped; their PIDs follow the predefined ones.
+    slave.stop_all()
+    slave.set_daq_ptr(DYNAMIC_LIST, 0, 0)
+    slave.write_daq(2, area + 8)
+    slave.set_daq_list_mode(DYNAMIC_LIST, EVENT_10MS)
+    assert slave.select(PREDEFINED_LIST) == 0
+    assert slave.select(DYNAMIC_LIST) == 2
+    slave.start_selected()
+    assert sorted(slave.trigger(EVENT_10MS)) == [predefined_dto, bytes((0x02, 0x88, 0x77))]
+
+    slave.ok(Command.FREE_DAQ)
+    assert slave.trigger(EVENT_10MS) == [predefined_dto]
+    slave.ok(Command.ALLOC_DAQ, 0, *struct.pack("<H", 2))
+    slave.ok(Command.ALLOC_ODT, 0, *struct.pack("<HB", DYNAMIC_LIST + 1, 1))
+    assert slave.trigger(EVENT_10MS) == [predefined_dto]
+
+
+def test_sampler_matches_the_gather_path(slave):
+    slave.set_daq_list_mode(PREDEFINED_LIST, EVENT_10MS)
+    slave.set_daq_list_mode(UNSAMPLED_LIST, EVENT_10MS)
+    assert slave.select(PREDEFINED_LIST) == 0
+    assert slave.select(UNSAMPLED_LIST) == 1
+    slave.start_selected()
+
+    for counter, level in ((0, 0), (0x11223344, 0x5566), (0xffffffff, 0x8001), (0x80000000, 0xffff)):
+        measurement(slave, "<I", 0, counter)
+        measurement(slave, "<H", 4, level)
+        sampled, gathered = sorted(slave.trigger(EVENT_10MS))
+        assert sampled[0] == 0 and gathered[0] == 1
+        assert sampled[1 : ] == gathered[1 : ] == struct.pack("<IH", counter, level)
+
+
+def test_write_daq_multiple_validates_the_whole_packet(slave):
+    area = slave.XcpSlave_GetMeasurementArea()
+    memory = (ctypes.c_uint8 * 4096).from_address(area)
+    memory[32 : 40] = range(0x20, 0x28)
+
+    slave.ok(Command.FREE_DAQ)
+    slave.ok(Command.ALLOC_DAQ, 0, *struct.pack("<H", 1))
+    slave.ok(Command.ALLOC_ODT, 0, *struct.pack("<HB", DYNAMIC_LIST, 1))
+    slave.ok(Command.ALLOC_ODT_ENTRY, 0, *struct.pack("<HBB", DYNAMIC_LIST, 0, 3))
+    slave.set_daq_ptr(DYNAMIC_LIST, 0, 0)
+    assert slave.write_daq_multiple((1, area + 32), (2, area + 34), (4, area + 36))[0] == 0xFF
+
+    # More elements than fit into a CTO.
+    slave.set_daq_ptr(DYNAMIC_LIST, 0, 0)
+    response = slave.write_daq_multiple(*[(1, area)] * 7, count = 8)
+    assert tuple(response) == (0xFE, Xcp_ReturnType.ERR_CMD_SYNTAX)
+
+    # The last element would run past the end of the ODT.
+    slave.set_daq_ptr(DYNAMIC_LIST, 0, 1)
+    response = slave.write_daq_multiple((1, area), (1, area), (1, area))
+    assert tuple(response) == (0xFE, Xcp_ReturnType.ERR_OUT_OF_RANGE)
+
+    # Bit offsets are 0x00 .. 0x1f or 0xff.
+    slave.set_daq_ptr(DYNAMIC_LIST, 0, 0)
+    data = slave.daq_element(1, area) + slave.daq_element(1, area, bit_offset = 0x20)
+    response = slave.command(Command.WRITE_DAQ_MULTIPLE, 2, *data)
+    assert tuple(response) == (0xFE, Xcp_ReturnType.ERR_OUT_OF_RANGE)
+
+    # Rejected packets left the entries alone.
+    slave.set_daq_list_mode(DYNAMIC_LIST, EVENT_10MS)
+    pid = slave.select(DYNAMIC_LIST)
+    slave.start_selected()
+    assert slave.trigger(EVENT_10MS) == [bytes((pid, 0x20, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27))]
+
+
+##
+##  Frame batching.
+##
+def test_dtos_are_batched_into_frames(slave):
+    area = slave.XcpSlave_GetMeasurementArea()
+    memory = (ctypes.c_uint8 * 4096).from_address(area)
+    memory[64 : 96] = range(0x40, 0x60)
+    dto_size = 33   # PID and one 32 byte entry.
+    packet_size = 4 + dto_size
+    per_frame = 256 // packet_size
+
+    pid = dynamic_list(slave, EVENT_10MS, [(32, area + 64)])
+    dto = bytes((pid, )) + bytes(range(0x40, 0x60))
+
+    # Queue-empty flushes: with a deadline of zero, each drain ends with a frame.
+    assert slave.trigger(EVENT_10MS) == [dto]
+    slave.XcpDaq_TriggerEvent(EVENT_10MS)
+    slave.XcpDaq_TriggerEvent(EVENT_10MS)
+    slave.Xcp_MainFunction()
+    frames = slave.frames()
+    assert len(frames) == 1
+    assert [payload for _, payload in slave.packets(frames[0])] == [dto] * 2
+
+    # A packet that doesn't fit any more starts the next frame.
+    for _ in range(per_frame + 1):
+        slave.XcpDaq_TriggerEvent(EVENT_10MS)
+    slave.Xcp_MainFunction()
+    frames = slave.frames()
+    assert [len(frame) for frame in frames] == [per_frame * packet_size, packet_size]
+    packets = [packet for frame in frames for packet in slave.packets(frame)]
+    assert [payload for _, payload in packets] == [dto] * (per_frame + 1)
+    # Every packet has a header of its own, counters run on across frames.
+    counters = [counter for counter, _ in packets]
+    assert counters == list(range(counters[0], counters[0] + per_frame + 1))
+
+
+##
+##  Address mapper.
+##
+def test_remap_switches_running_lists_to_the_new_page(slave):
+    area = slave.XcpSlave_GetMeasurementArea()
+    memory = (ctypes.c_uint8 * 4096).from_address(area)
+    memory[PAGE_SIZE : PAGE_SIZE + 4] = [0x01, 0x02, 0x03, 0x04]
+    memory[2 * PAGE_SIZE : 2 * PAGE_SIZE + 4] = [0x0A, 0x0B, 0x0C, 0x0D]
+    memory[16 : 18] = [0x55, 0xAA]
+
+    pid = dynamic_list(slave, EVENT_100MS, [(2, PAGE_WINDOW), (2, PAGE_WINDOW + 2), (2, area + 16)])
+    assert slave.trigger(EVENT_100MS) == [bytes((pid, 0x01, 0x02, 0x03, 0x04, 0x55, 0xAA))]
+
+    # Sources are resolved once at start, a page switch takes effect on remapping.
+    assert slave.XcpSlave_SwitchPage(2 * PAGE_SIZE)
+    assert slave.trigger(EVENT_100MS) == [bytes((pid, 0x0A, 0x0B, 0x0C, 0x0D, 0x55, 0xAA))]
+    memory[2 * PAGE_SIZE] = 0x0E
+    assert slave.trigger(EVENT_100MS) == [bytes((pid, 0x0E, 0x0B, 0x0C, 0x0D, 0x55, 0xAA))]
+
+    # Ranges no entry overlaps leave the running lists alone.
+    assert slave.XcpDaq_RemapAddressRange(PAGE_WINDOW + 4, PAGE_SIZE - 4)
+    assert slave.trigger(EVENT_100MS) == [bytes((pid, 0x0E, 0x0B, 0x0C, 0x0D, 0x55, 0xAA))]
+
+    assert slave.XcpSlave_SwitchPage(PAGE_SIZE)
+    assert slave.trigger(EVENT_100MS) == [bytes((pid, 0x01, 0x02, 0x03, 0x04, 0x55, 0xAA))]
+
+
+##
+##  Remote memory.
+##
+def test_remote_memory_is_calibrated_and_sampled(slave, target):
+    process, _ = target
+
+    slave.short_download(0x08, bytes((0xA0, 0xA1)), ext = REMOTE)
+    assert target_memory(process)[8 : 10] == bytes((0xA0, 0xA1))
+    assert slave.short_upload(4, 0x06, ext = REMOTE) == bytes((0x06, 0x07, 0xA0, 0xA1))
+
+    pid = dynamic_list(slave, EVENT_10MS, [(4, 0x06), (2, 0x20)], ext = REMOTE)
+    assert slave.trigger(EVENT_10MS) == [bytes((pid, 0x06, 0x07, 0xA0, 0xA1, 0x20, 0x21))]
+    slave.short_download(0x20, bytes((0x55, )), ext = REMOTE)
+    assert slave.trigger(EVENT_10MS) == [bytes((pid, 0x06, 0x07, 0xA0, 0xA1, 0x55, 0x21))]
+    assert slave.XcpDaq_GetRemoteReadErrors(EVENT_10MS) == 0
+
+
+def test_failed_remote_writes_are_denied(slave, target):
+    process, _ = target
+
+    # Offset 0x1000 is the inaccessible page.
+    assert slave.error(Command.SHORT_DOWNLOAD, 2, 0, REMOTE, *struct.pack("<I", 0x1000), 0xA0, 0xA1) == Xcp_ReturnType.ERR_ACCESS_DENIED
+    slave.ok(Command.SET_MTA, 0, 0, REMOTE, *struct.pack("<I", 0x0FFF))
+    assert slave.error(Command.DOWNLOAD, 2, 0xB0, 0xB1) == Xcp_ReturnType.ERR_ACCESS_DENIED
+    slave.ok(Command.SET_MTA, 0, 0, REMOTE, *struct.pack("<I", 0x04))
+    slave.ok(Command.DOWNLOAD, 2, 0xB0, 0xB1)
+    assert target_memory(process)[4 : 6] == bytes((0xB0, 0xB1))
+
+
+def test_failed_remote_reads_drop_the_dto(slave, target):
+    process, page = target
+
+    pid = dynamic_list(slave, EVENT_10MS, [(4, 0x10)], ext = REMOTE)
+    dto = bytes((pid, 0x10, 0x11, 0x12, 0x13))
+    assert slave.trigger(EVENT_10MS) == [dto]
+
+    # Short read: the entry starts two bytes before the inaccessible page.
+    slave.XcpHw_SetRemoteProcess(process.pid, page + 4094 - 0x10)
+    assert slave.trigger(EVENT_10MS) == []
+    assert slave.XcpDaq_GetRemoteReadErrors(EVENT_10MS) == 1
+    # EFAULT: within the inaccessible page.
+    slave.XcpHw_SetRemoteProcess(process.pid, page + 4096)
+    assert slave.trigger(EVENT_10MS) == []
+    assert slave.XcpDaq_GetRemoteReadErrors(EVENT_10MS) == 2
+
+    # An overrun pending while reads fail is indicated by the next DTO actually sent.
+    slave.XcpHw_SetRemoteProcess(process.pid, page)
+    for _ in range(256):
+        slave.XcpDaq_TriggerEvent(EVENT_10MS)
+        if slave.XcpDaq_GetEventOverruns(EVENT_10MS):
+            break
+    assert slave.XcpDaq_GetEventOverruns(EVENT_10MS) == 1
+    queued = slave.trigger(EVENT_10MS)
+    assert queued and all(payload == dto for payload in queued)
+    slave.XcpHw_SetRemoteProcess(process.pid, page + 4096)
+    assert slave.trigger(EVENT_10MS) == []
+    assert slave.XcpDaq_GetRemoteReadErrors(EVENT_10MS) == 3
+    slave.XcpHw_SetRemoteProcess(process.pid, page)
+    assert slave.trigger(EVENT_10MS) == [bytes((pid | 0x80, )) + dto[1 : ]]
+    assert slave.trigger(EVENT_10MS) == [dto]
@@ -40,7 +40,7 @@
 #define XCP_ENABLE_SLAVE_BLOCKMODE                  XCP_OFF
 #define XCP_ENABLE_MASTER_BLOCKMODE                 XCP_OFF
 
-#define XCP_ENABLE_STIM                             XCP_OFF
+#define XCP_ENABLE_STIM                             XCP_ON
 
 #define XCP_CHECKSUM_METHOD                         XCP_CHECKSUM_METHOD_XCP_CRC_16_CITT
 #define XCP_CHECKSUM_CHUNKED_CALCULATION            XCP_ON
@@ -54,25 +54,32 @@
 #define XCP_MAX_DTO                                 (8)
 
 #define XCP_ENABLE_DAQ_COMMANDS                     XCP_ON
+#define XCP_ENABLE_SET_REQUEST                      XCP_ON
 
 /*
  * **  DAQ Settings.
  * */
 #define XCP_DAQ_CONFIG_TYPE                         XCP_DAQ_CONFIG_TYPE_DYNAMIC
-#define XCP_DAQ_DTO_BUFFER_SIZE                     (40)
+#define XCP_DAQ_DTO_BUFFER_SIZE                     (64)
 #define XCP_DAQ_ENABLE_PREDEFINED_LISTS             XCP_OFF
 #define XCP_DAQ_TIMESTAMP_UNIT                      (XCP_DAQ_TIMESTAMP_UNIT_10US)
 #define XCP_DAQ_TIMESTAMP_SIZE                      (XCP_DAQ_TIMESTAMP_SIZE_4)
-#define XCP_DAQ_ENABLE_PRESCALER                    XCP_OFF
+#define XCP_DAQ_ENABLE_PRESCALER                    XCP_ON
 #define XCP_DAQ_ENABLE_ADDR_EXT                     XCP_OFF
 #define XCP_DAQ_ENABLE_BIT_OFFSET                   XCP_OFF
-#define XCP_DAQ_ENABLE_PRIORITIZATION               XCP_OFF
+#define XCP_DAQ_ENABLE_PRIORITIZATION               XCP_ON
+#define XCP_DAQ_OVERLOAD_INDICATION                 XCP_DAQ_OVERLOAD_INDICATION_PID
+#define XCP_DAQ_ENABLE_SEQLOCK                      XCP_ON
+#define XCP_DAQ_ENABLE_RESUME                       XCP_ON
 #define XCP_DAQ_ENABLE_ALTERNATING                  XCP_OFF
 #define XCP_DAQ_ENABLE_CLOCK_ACCESS_ALWAYS          XCP_ON
 #define XCP_DAQ_ENABLE_WRITE_THROUGH                XCP_ON
 #define XCP_DAQ_MAX_DYNAMIC_ENTITIES                (100)
 #define XCP_DAQ_MAX_EVENT_CHANNEL                   (3)
-#define XCP_DAQ_ENABLE_MULTIPLE_DAQ_LISTS_PER_EVENT XCP_OFF
+#define XCP_DAQ_ENABLE_MULTIPLE_DAQ_LISTS_PER_EVENT XCP_ON
+#define XCP_DAQ_MAX_LISTS_PER_EVENT                 (4)
+#define XCP_DAQ_ENABLE_LOCK_FREE_DTO_QUEUE          XCP_ON
+#define XCP_DAQ_ENABLE_TRANSMIT_TASK                XCP_ON
 
 
 /*
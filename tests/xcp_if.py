@@ -6,7 +6,8 @@ from loader import API, Function, Variable
 from xcp_types import (
     Xcp_ReturnType, XcpDaq_ListIntegerType, XcpDaq_ODTIntegerType, XcpDaq_ODTEntryIntegerType,
     XcpDaq_ListConfigurationType, XcpDaq_ListStateType, XcpDaq_ODTEntryType, XcpDaq_EventType,
-    XcpDaq_ProcessorStateType, XcpDaq_ProcessorType, XcpDaq_MessageType, XcpDaq_EntityType
+    XcpDaq_ProcessorStateType, XcpDaq_ProcessorType, XcpDaq_MessageType,
+    XcpDaq_QueueStatisticsType, XcpDaq_StimLatencyType, XcpDaq_SeqLockType
 )
 
 
@@ -26,24 +27,52 @@ class XCP(API):
         Function("XcpDaq_ValidateConfiguration", ctypes.c_bool),
         Function("XcpDaq_ValidateOdtEntry", ctypes.c_bool, [XcpDaq_ListIntegerType, XcpDaq_ODTIntegerType, XcpDaq_ODTEntryIntegerType]),
         Function("XcpDaq_MainFunction"),
-        Function("XcpDaq_AddEventChannel", None, [XcpDaq_ListIntegerType, ctypes.c_uint16]),
+        Function("XcpDaq_AddEventChannel", ctypes.c_bool, [XcpDaq_ListIntegerType, ctypes.c_uint16]),
         Function("XcpDaq_CopyMemory", None, [ctypes.c_void_p, ctypes.c_void_p, ctypes.c_uint32]),
+        Function("XcpUtl_SampleCopy", None, [ctypes.c_void_p, ctypes.c_void_p, ctypes.c_uint32]),
         Function("XcpDaq_GetEventConfiguration", ctypes.POINTER(XcpDaq_EventType), [ctypes.c_uint16]),
-        Function("XcpDaq_TriggerEvent", None, [ctypes.c_int8]),
+        Function("XcpDaq_TriggerEvent", None, [ctypes.c_uint16]),
+        Function("XcpDaq_TriggerEventAt", None, [ctypes.c_uint16, ctypes.c_uint64]),
+        Function("XcpDaq_TriggerEventsAt", None, [ctypes.POINTER(ctypes.c_uint16), ctypes.c_uint16, ctypes.c_uint64]),
         Function("XcpDaq_GetProperties", None, [ctypes.POINTER(ctypes.c_int8)]),
         Function("XcpDaq_GetListCount", XcpDaq_ListIntegerType),
         Function("XcpDaq_SetProcessorState", None, [ctypes.c_int8]), # XcpDaq_ProcessorStateType
-        Function("XcpDaq_StartSelectedLists"),
-        Function("XcpDaq_StopSelectedLists"),
-        Function("XcpDaq_StopAllLists"),
+        Function("XcpDaq_StartSelectedLists", Xcp_ReturnType),
+        Function("XcpDaq_StopSelectedLists", Xcp_ReturnType),
+        Function("XcpDaq_StopAllLists", Xcp_ReturnType),
+        Function("XcpDaq_EnterPlan", ctypes.c_void_p, [ctypes.c_uint16]),
+        Function("XcpDaq_LeavePlan", None, [ctypes.c_uint16]),
         Function("XcpDaq_GetFirstPid", ctypes.c_bool, [XcpDaq_ListIntegerType, ctypes.POINTER(XcpDaq_ODTIntegerType)]),
+        Function("XcpDaq_EnqueueMessage", ctypes.c_bool, [ctypes.c_uint16, ctypes.c_uint8, ctypes.POINTER(XcpDaq_MessageType)]),
         Function("XcpDaq_DequeueMessage", ctypes.c_bool, [ctypes.POINTER(XcpDaq_MessageType)]),
+        Function("XcpDaq_ReserveMessage", ctypes.POINTER(ctypes.c_uint8), [ctypes.c_uint16, ctypes.c_uint8, ctypes.c_uint8]),
+        Function("XcpDaq_CommitMessage", None, [ctypes.c_uint16, ctypes.c_uint8, ctypes.c_uint8]),
+        Function("XcpDaq_GetQueueStatistics", None, [ctypes.c_uint8, ctypes.POINTER(XcpDaq_QueueStatisticsType)]),
+        Function("XcpDaq_GetListOverruns", ctypes.c_uint32, [XcpDaq_ListIntegerType]),
+        Function("XcpDaq_GetEventOverruns", ctypes.c_uint32, [ctypes.c_uint16]),
+        Function("XcpDaq_ReceiveStim", None, [ctypes.c_char_p, ctypes.c_uint16]),
+        Function("XcpDaq_GetStimLatency", ctypes.c_bool, [XcpDaq_ListIntegerType, ctypes.POINTER(XcpDaq_StimLatencyType)]),
+        Function("XcpDaq_SetEventSeqLock", None, [ctypes.c_uint16, ctypes.POINTER(XcpDaq_SeqLockType)]),
+        Function("XcpDaq_SeqLockWriteBegin", None, [ctypes.POINTER(XcpDaq_SeqLockType)]),
+        Function("XcpDaq_SeqLockWriteEnd", None, [ctypes.POINTER(XcpDaq_SeqLockType)]),
+        Function("XcpDaq_GetSeqLockSkips", ctypes.c_uint32, [ctypes.c_uint16]),
+        Function("XcpDaq_StoreConfiguration", ctypes.c_uint32, [ctypes.c_void_p, ctypes.c_uint32, ctypes.c_bool, ctypes.c_uint16]),
+        Function("XcpDaq_RestoreConfiguration", ctypes.c_bool, [ctypes.c_void_p, ctypes.c_uint32, ctypes.POINTER(ctypes.c_uint16)]),
+        Function("XcpDaq_PeekMessage", ctypes.c_bool, [ctypes.POINTER(XcpDaq_MessageType)]),
+        Function("XcpDaq_ReleaseMessage"),
         Function("XcpDaq_SetPointer", None, [XcpDaq_ListIntegerType, XcpDaq_ODTIntegerType, XcpDaq_ODTEntryIntegerType]),
         Function("XcpDaq_GetCounts", None, [ctypes.POINTER(ctypes.c_uint16), ctypes.POINTER(ctypes.c_uint16), ctypes.POINTER(ctypes.c_uint16)]),
-        Function("XcpDaq_TotalDynamicEntityCount", ctypes.c_uint16),
-        Function("XcpDaq_GetDynamicEntities", ctypes.POINTER(XcpDaq_EntityType)),
-        Function("XcpDaq_GetDynamicEntity", ctypes.POINTER(XcpDaq_EntityType), [ctypes.c_uint16]),
-        Function("XcpDaq_GetDtoBuffer", ctypes.POINTER(ctypes.c_uint8)),
+        Function("XcpDaq_GetDynamicMemory", None, [ctypes.POINTER(ctypes.c_uint32), ctypes.POINTER(ctypes.c_uint32)]),
+        Function("XcpDaq_GetDtoBuffer", ctypes.POINTER(ctypes.c_uint8), [ctypes.c_uint16, ctypes.c_uint8]),
+        Function("XcpDaq_GetGatherEntryCount", ctypes.c_uint16),
+        Function("XcpTest_GetSentDtoCount", ctypes.c_uint32),
+        Function("XcpTest_GetLastSentDto", ctypes.POINTER(ctypes.c_uint8)),
+        Function("XcpDaqTest_DtoQueueStress", ctypes.c_uint32, [ctypes.c_uint16, ctypes.c_uint32, ctypes.c_bool]),
+        Function("XcpDaqTest_GetTransmitRequests", None, [ctypes.POINTER(ctypes.c_uint32), ctypes.POINTER(ctypes.c_uint32), ctypes.POINTER(ctypes.c_uint32)]),
+        Function("XcpDaqTest_ResetTransmitRequests"),
+        Function("XcpDaq_WaitForMessages"),
+        Function("XcpDaqTest_SeqLockStress", ctypes.c_uint32, [ctypes.c_uint8, ctypes.c_void_p, ctypes.POINTER(XcpDaq_SeqLockType), ctypes.c_uint32]),
+        Function("XcpDaqTest_PlanStress", ctypes.c_uint32, [ctypes.c_uint8, ctypes.c_void_p, ctypes.c_uint32]),
         #Function("", ),
         #Function("", ),
     )
@@ -54,6 +83,12 @@ class XCP(API):
         odtCount = ctypes.c_uint16()
         self.XcpDaq_GetCounts(ctypes.byref(entityCount), ctypes.byref(listCount), ctypes.byref(odtCount))
         return (entityCount.value, listCount.value, odtCount.value, )
+
+    def get_dynamic_memory(self):
+        used = ctypes.c_uint32()
+        size = ctypes.c_uint32()
+        self.XcpDaq_GetDynamicMemory(ctypes.byref(used), ctypes.byref(size))
+        return (used.value, size.value, )
 """
 /*
 **  Predefined DAQ constants.
@@ -14,10 +14,11 @@ XCP_DAQ_BEGIN_EVENTS
         XCP_DAQ_EVENT_CHANNEL_TIME_UNIT_1MS,
         0
     ),
-    XCP_DAQ_DEFINE_EVENT("EVT 10ms",
+    XCP_DAQ_DEFINE_EVENT_PRIO("EVT 10ms",
         XCP_DAQ_EVENT_CHANNEL_TYPE_DAQ | XCP_DAQ_CONSISTENCY_DAQ_LIST,
         XCP_DAQ_EVENT_CHANNEL_TIME_UNIT_1MS,
-        10
+        10,
+        1
     ),
 XCP_DAQ_END_EVENTS
 
@@ -75,3 +76,27 @@ Xcp_StateType * Xcp_GetState(void)
 
     return tState;
 }
+
+uint32_t XcpHw_GetTimerCounter(void)
+{
+    return UINT32(0x04030201);
+}
+
+static uint32_t XcpTest_SentDtoCount = 0;
+static uint8_t XcpTest_LastSentDto[XCP_MAX_DTO];
+
+void Xcp_SendDto(XcpDaq_MessageType const * msg)
+{
+    XcpUtl_MemCopy(XcpTest_LastSentDto, msg->data, UINT32(msg->dlc));
+    XcpTest_SentDtoCount++;
+}
+
+uint32_t XcpTest_GetSentDtoCount(void)
+{
+    return XcpTest_SentDtoCount;
+}
+
+uint8_t * XcpTest_GetLastSentDto(void)
+{
+    return &XcpTest_LastSentDto[0];
+}
@@ -59,12 +59,6 @@ class Xcp_ReturnType(enum.IntEnum):
 
     ERR_SUCCESS             = 0xff
 
-class XcpDaq_EntityKindType(enum.IntEnum):
-    XCP_ENTITY_UNUSED       = 0
-    XCP_ENTITY_DAQ_LIST     = 1
-    XCP_ENTITY_ODT          = 2
-    XCP_ENTITY_ODT_ENTRY    = 3
-
 class XcpDaq_MtaType(ctypes.Structure):
     _fields_ = [
         ("address", ctypes.c_uint32),
@@ -87,19 +81,12 @@ class XcpDaq_DynamicListType(ctypes.Structure):
         ("numOdts", ctypes.c_uint8),
         ("firstOdt", ctypes.c_uint16),
         ("mode", ctypes.c_uint8),
-    ]
-
-class XcpDaq_EntityUnionType(ctypes.Structure):
-    _fields_ = [
-        ("odtEntry", XcpDaq_ODTEntryType),
-        ("odt", XcpDaq_ODTType),
-        ("daqList", XcpDaq_DynamicListType),
-    ]
-
-class XcpDaq_EntityType(ctypes.Structure):
-    _fields_ = [
-        ("kind", ctypes.c_uint8),
-        ("entity", XcpDaq_EntityUnionType),
+        ("prescaler", ctypes.c_uint8),
+        ("counter", ctypes.c_uint8),
+        ("priority", ctypes.c_uint8),
+        ("overload", ctypes.c_uint8),
+        ("firstPid", ctypes.c_uint8),
+        ("overruns", ctypes.c_uint32),
     ]
 
 class XcpDaq_ListMode(enum.IntEnum):
@@ -126,8 +113,24 @@ class XcpDaq_ListConfigurationType(ctypes.Structure):
 class XcpDaq_ListStateType(ctypes.Structure):
     _fields_ = [
         ("mode", ctypes.c_uint8),
-#        ("prescaler", ctypes.c_uint8),
-#        ("counter", ctypes.c_uint8),
+        ("prescaler", ctypes.c_uint8),
+        ("counter", ctypes.c_uint8),
+        ("priority", ctypes.c_uint8),
+        ("overload", ctypes.c_uint8),
+        ("firstPid", XcpDaq_ODTIntegerType),
+        ("overruns", ctypes.c_uint32),
+    ]
+
+class XcpDaq_SeqLockType(ctypes.Structure):
+    _fields_ = [
+        ("sequence", ctypes.c_uint32),
+    ]
+
+class XcpDaq_StimLatencyType(ctypes.Structure):
+    _fields_ = [
+        ("last", ctypes.c_uint32),
+        ("max", ctypes.c_uint32),
+        ("applied", ctypes.c_uint32),
     ]
 
 class XcpDaq_EventType(ctypes.Structure):
@@ -137,7 +140,7 @@ class XcpDaq_EventType(ctypes.Structure):
         ("properties", ctypes.c_uint8),
         ("timeunit", ctypes.c_uint8),
         ("cycle", ctypes.c_uint8),
-        #("priority", ctypes.c_uint8),
+        ("priority", ctypes.c_uint8),
 
     ]
 
@@ -154,6 +157,12 @@ class XcpDaq_ProcessorType(ctypes.Structure):
         ("state", ctypes.c_uint8)
     ]
 
+class XcpDaq_QueueStatisticsType(ctypes.Structure):
+    _fields_ = [
+        ("depth", ctypes.c_uint32),
+        ("dropped", ctypes.c_uint32),
+    ]
+
 class XcpDaq_MessageType(ctypes.Structure):
     _fields_ = [
         ("dlc", ctypes.c_uint8),